@@ -127,6 +127,15 @@ function getWebviewContent() {
               <option value="string">String Option Set</option>
               <option value="ip">IPv4 Address</option>
               <option value="ip_mask">IPv4 Address + Netmask</option>
+              <option value="hostname">Hostname</option>
+              <option value="host">Hostname or IPv4 Address</option>
+              <option value="timestamp">Timestamp (ISO 8601)</option>
+              <option value="duration">Duration (nanoseconds)</option>
+              <option value="size">Byte Size</option>
+              <option value="uuid">UUID</option>
+              <option value="port">Port or Service Name</option>
+              <option value="glob">Glob Pattern</option>
+              <option value="range">Bracket Range (e.g. eth[0-47])</option>
             </select><br>
             <div class="parserParams"></div>
             <button type="button" class="removeArg">Remove Argument</button><br>
@@ -139,7 +148,7 @@ function getWebviewContent() {
             const type = parserSelect.value;
             paramsDiv.innerHTML = '';
 
-            if (["uint32", "uint64", "int", "float", "hex"].includes(type)) {
+            if (["uint32", "uint64", "int", "float", "hex", "duration", "size"].includes(type)) {
               paramsDiv.innerHTML += \`
                 <label>Min Value:</label><br>
                 <input type="number" name="argMin"><br>
@@ -215,6 +224,7 @@ function generateCLICommandCode(data) {
     enumEntries += `    ${enumName},\n`;
 
     let varType = '';
+    let varSuffix = '';
     let parseLine = '';
 
     switch (arg.parser) {
@@ -238,6 +248,35 @@ function generateCLICommandCode(data) {
         varType = 'CLIPAR_ULONG';
         parseLine = `if (!parse_hex_in_range(argv[${argIndex}], ${arg.min}, ${arg.max}, &${arg.name})) return ${argErrorStatus};`;
         break;
+      case 'timestamp':
+        varType = 'CLIPAR_INT64';
+        parseLine = `if (!parse_timestamp(argv[${argIndex}], &${arg.name})) return ${argErrorStatus};`;
+        break;
+      case 'duration':
+        varType = 'CLIPAR_UINT64';
+        parseLine = `if (!parse_duration_ns(argv[${argIndex}], ${arg.min}, ${arg.max}, &${arg.name})) return ${argErrorStatus};`;
+        break;
+      case 'size':
+        varType = 'CLIPAR_UINT64';
+        parseLine = `if (!parse_size_bytes(argv[${argIndex}], ${arg.min}, ${arg.max}, &${arg.name})) return ${argErrorStatus};`;
+        break;
+      case 'uuid':
+        varType = 'CLIPAR_UINT8';
+        varSuffix = '[16]';
+        parseLine = `if (!parse_uuid(argv[${argIndex}], ${arg.name})) return ${argErrorStatus};`;
+        break;
+      case 'port':
+        varType = 'CLIPAR_UINT32';
+        parseLine = `if (!parse_port(argv[${argIndex}], &${arg.name})) return ${argErrorStatus};`;
+        break;
+      case 'glob':
+        varType = 'glob_pattern_t';
+        parseLine = `if (!parse_glob(argv[${argIndex}], &${arg.name})) return ${argErrorStatus};`;
+        break;
+      case 'range':
+        varType = 'range_expansion_t';
+        parseLine = `if (!parse_range_expansion(argv[${argIndex}], &${arg.name})) return ${argErrorStatus};`;
+        break;
       case 'bool':
         varType = 'CLIPAR_BOOL';
         parseLine = `if (!parse_bool(argv[${argIndex}], &${arg.name})) return ${argErrorStatus};`;
@@ -245,7 +284,7 @@ function generateCLICommandCode(data) {
       case 'string':
         varType = 'CLIPAR_UINT';
         const options = arg.options.split(',').map(s => `"${s.trim()}"`).join(', ');
-        parseLine = `const char *${arg.name}_opts[] = { ${options} };
+        parseLine = `static const char *${arg.name}_opts[] = { ${options} };
     if (!parse_string_option(argv[${argIndex}], ${arg.name}_opts, sizeof(${arg.name}_opts)/sizeof(${arg.name}_opts[0]), &${arg.name})) return ${argErrorStatus};`;
         break;
       case 'ip':
@@ -254,10 +293,16 @@ function generateCLICommandCode(data) {
       case 'ip_mask':
         parseLine = `if (!parse_ip_address_with_netmask(argv[${argIndex}])) return ${argErrorStatus}; // Manual IP/mask storage required`;
         break;
+      case 'hostname':
+        parseLine = `if (!parse_hostname(argv[${argIndex}], false)) return ${argErrorStatus}; // Manual hostname storage required`;
+        break;
+      case 'host':
+        parseLine = `if (!parse_hostname(argv[${argIndex}], true)) return ${argErrorStatus}; // Manual host storage required`;
+        break;
     }
 
     if (varType) {
-      varDecls += `    ${varType} ${arg.name};\n`;
+      varDecls += `    ${varType} ${arg.name}${varSuffix};\n`;
     }
     parseCalls += `    ${parseLine}\n`;
     argIndex++;
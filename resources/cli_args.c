@@ -10,6 +10,34 @@
 #include <stdlib.h>
 #include <ctype.h>
 #include <string.h>
+#include <stdint.h>
+
+/*
+ * SIMD fast paths are used when the compiler targets the instruction set, unless
+ * CLIPAR_NO_SIMD is defined. Every fast path has a portable scalar equivalent.
+ */
+#if defined(__SSSE3__) && !defined(CLIPAR_NO_SIMD)
+  #include <tmmintrin.h>
+  #define CLIPAR_USE_SSSE3 1
+#else
+  #define CLIPAR_USE_SSSE3 0
+#endif
+
+/*
+ * parse_string_option() keeps a per-thread hash index of recently used option tables,
+ * unless CLIPAR_NO_OPTION_CACHE is defined or the compiler has no thread-local storage.
+ */
+#if !defined(CLIPAR_NO_OPTION_CACHE) && !defined(CLIPAR_THREAD_LOCAL)
+  #if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L)
+    #define CLIPAR_THREAD_LOCAL _Thread_local
+  #elif defined(__GNUC__)
+    #define CLIPAR_THREAD_LOCAL __thread
+  #elif defined(_MSC_VER)
+    #define CLIPAR_THREAD_LOCAL __declspec(thread)
+  #else
+    #define CLIPAR_NO_OPTION_CACHE
+  #endif
+#endif
 
 /**
  * @brief Checks if the given string contains only digit characters.
@@ -98,306 +126,3220 @@ static CLIPAR_BOOL iequals(const CLIPAR_CHAR *s1, const CLIPAR_CHAR *s2)
     return ((*s1 == '\0') && (*s2 == '\0'));
 }
 
+/* Character classes used by the hostname validator. */
+#define HN_ALPHA  0x01u
+#define HN_DIGIT  0x02u
+#define HN_HYPHEN 0x04u
+#define HN_DOT    0x08u
+
+/* Maximum lengths from RFC 1035 section 2.3.4 (text form, no trailing dot). */
+#define HN_MAX_LABEL_LEN 63u
+#define HN_MAX_NAME_LEN  253u
+
 /**
- * @brief Parses an unsigned 32-bit integer from a string and validates its range.
+ * @brief Byte to hostname character class lookup table.
  *
- * @param arg The input string.
- * @param min Minimum allowed value.
- * @param max Maximum allowed value.
- * @param out Pointer to store the parsed value.
- * @return CLIPAR_BOOL true if successful and within range; false otherwise.
+ * Letters map to HN_ALPHA, digits to HN_DIGIT, '-' to HN_HYPHEN and '.' to HN_DOT.
+ * Every other byte (including all non-ASCII bytes) maps to 0 and is rejected.
  */
-CLIPAR_BOOL parse_uint32_in_range(const CLIPAR_CHAR *arg, CLIPAR_UINT32 min, CLIPAR_UINT32 max, CLIPAR_UINT32 *out)
+static const unsigned char hostname_class[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 8, 0,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0,
+    0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+    0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+    /* 0x80 - 0xFF: zero-initialized */
+};
+
+/**
+ * @brief Checks if the given string is an RFC 1123 host name.
+ *
+ * Labels are 1 to 63 letters, digits or hyphens and may not begin or end with a hyphen.
+ * The whole name is at most 253 characters, not counting a single optional trailing dot.
+ * A name whose last label is all digits is rejected so it cannot be confused with an
+ * IPv4 address. The check is a single pass over the string with one table lookup per byte.
+ *
+ * @param str The input string.
+ * @return CLIPAR_BOOL true if the string is a valid host name; false otherwise.
+ */
+static CLIPAR_BOOL is_rfc1123_hostname(const CLIPAR_CHAR *str)
 {
-    if ((arg == NULL) || (*arg == '\0')) {
-        return false;
+    const unsigned char *p = (const unsigned char *)str;
+    CLIPAR_SIZE_T total = 0;
+    CLIPAR_SIZE_T label_len = 0;
+    unsigned int prev = HN_DOT;
+    unsigned int label_classes = 0;
+    unsigned int last_label_classes = 0;
+
+    for (; *p != '\0'; ++p, ++total) {
+        unsigned int cls = hostname_class[*p];
+        if ((cls == 0) || (total > HN_MAX_NAME_LEN)) {
+            return false;
+        }
+        if (cls == HN_DOT) {
+            if ((label_len == 0) || (prev == HN_HYPHEN)) {
+                return false;
+            }
+            last_label_classes = label_classes;
+            label_classes = 0;
+            label_len = 0;
+        } else {
+            if ((cls == HN_HYPHEN) && (prev == HN_DOT)) {
+                return false;
+            }
+            if (++label_len > HN_MAX_LABEL_LEN) {
+                return false;
+            }
+            label_classes |= cls;
+        }
+        prev = cls;
     }
-    if (!is_digits(arg)) {
+
+    if (prev == HN_HYPHEN) {
         return false;
     }
-    char *endptr = NULL;
-    unsigned long val = strtoul(arg, &endptr, 10);
-    if (*endptr != '\0') {
-        return false;
+    if (prev == HN_DOT) {
+        /* Trailing dot: only valid after at least one label. */
+        if (total == 0) {
+            return false;
+        }
+        total--;
+    } else {
+        last_label_classes = label_classes;
     }
-    if ((val < min) || (val > max)) {
+    if ((total == 0) || (total > HN_MAX_NAME_LEN)) {
         return false;
     }
-    if (out != NULL) {
-        *out = (CLIPAR_UINT32)val;
-    }
-    return true;
+    return (last_label_classes != HN_DIGIT);
 }
 
 /**
- * @brief Parses an unsigned 64-bit integer from a string and validates its range.
+ * @brief Loads 8 bytes as a little-endian 64-bit word.
  *
- * @param arg The input string.
- * @param min Minimum allowed value.
- * @param max Maximum allowed value.
- * @param out Pointer to store the parsed value.
- * @return CLIPAR_BOOL true if successful and within range; false otherwise.
+ * Byte i of the input ends up in bits [8*i, 8*i+7] regardless of host byte order,
+ * so the SWAR helpers below can address character positions as fixed lanes.
+ *
+ * @param p Pointer to at least 8 readable bytes.
+ * @return CLIPAR_UINT64 The assembled word.
  */
-CLIPAR_BOOL parse_uint64_in_range(const CLIPAR_CHAR *arg, CLIPAR_UINT64 min, CLIPAR_UINT64 max, CLIPAR_UINT64 *out)
+static inline CLIPAR_UINT64 load_le64(const CLIPAR_CHAR *p)
 {
-    if ((arg == NULL) || (*arg == '\0')) {
-        return false;
-    }
-    if (!is_digits(arg)) {
-        return false;
-    }
-    char *endptr = NULL;
-    unsigned long long val = strtoull(arg, &endptr, 10);
-    if (*endptr != '\0') {
-        return false;
-    }
-    if ((val < min) || (val > max)) {
-        return false;
-    }
-    if (out != NULL) {
-        *out = (CLIPAR_UINT64)val;
-    }
-    return true;
+    const unsigned char *b = (const unsigned char *)p;
+    return ((CLIPAR_UINT64)b[0])       | ((CLIPAR_UINT64)b[1] << 8)  |
+           ((CLIPAR_UINT64)b[2] << 16) | ((CLIPAR_UINT64)b[3] << 24) |
+           ((CLIPAR_UINT64)b[4] << 32) | ((CLIPAR_UINT64)b[5] << 40) |
+           ((CLIPAR_UINT64)b[6] << 48) | ((CLIPAR_UINT64)b[7] << 56);
 }
 
 /**
- * @brief Parses a signed integer from a string and validates its range.
+ * @brief Checks that all eight lanes of a word hold ASCII digits.
  *
- * @param arg The input string.
- * @param min Minimum allowed value.
- * @param max Maximum allowed value.
- * @param out Pointer to store the parsed value.
- * @return CLIPAR_BOOL true if successful and within range; false otherwise.
+ * @param word Eight characters loaded with load_le64().
+ * @return CLIPAR_BOOL true if every byte is in '0'..'9'; false otherwise.
  */
-CLIPAR_BOOL parse_int_in_range(const CLIPAR_CHAR *arg, CLIPAR_INT min, CLIPAR_INT max, CLIPAR_INT *out)
+static CLIPAR_BOOL swar_is_eight_digits(CLIPAR_UINT64 word)
 {
-    if ((arg == NULL) || (*arg == '\0')) {
-        return false;
-    }
-    if (!is_valid_int(arg)) {
-        return false;
-    }
-    char *endptr = NULL;
-    long val = strtol(arg, &endptr, 10);
-    if (*endptr != '\0') {
+    return (((word & 0xF0F0F0F0F0F0F0F0ULL) |
+             (((word + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) == 0x3333333333333333ULL);
+}
+
+/**
+ * @brief Converts eight ASCII digits (first digit in lane 0) to their value.
+ *
+ * Combines digits pairwise, then in groups of four, then eight, with one multiply per step.
+ *
+ * @param word Eight digits loaded with load_le64(), already checked with swar_is_eight_digits().
+ * @return CLIPAR_UINT32 The value, 0 to 99999999.
+ */
+static CLIPAR_UINT32 swar_eight_digits_value(CLIPAR_UINT64 word)
+{
+    word = ((word & 0x0F0F0F0F0F0F0F0FULL) * 2561) >> 8;
+    word = ((word & 0x00FF00FF00FF00FFULL) * 6553601) >> 16;
+    return (CLIPAR_UINT32)(((word & 0x0000FFFF0000FFFFULL) * 42949672960001ULL) >> 32);
+}
+
+/**
+ * @brief Validates a fixed 8-character layout of digits and separators in one word.
+ *
+ * Lanes selected by digit_mask must hold '0'..'9'; every other lane must equal the
+ * corresponding byte of separators. On success, lane i of *pairs holds the two-digit
+ * value 10 * digit[i] + digit[i + 1] (separator lanes count as 0).
+ *
+ * @param word Eight input characters loaded with load_le64().
+ * @param digit_mask 0xFF in each lane that must be a digit, 0x00 elsewhere.
+ * @param separators Expected bytes for the non-digit lanes, 0x00 in digit lanes.
+ * @param pairs Pointer to store the per-lane two-digit values.
+ * @return CLIPAR_BOOL true if the layout matches; false otherwise.
+ */
+static CLIPAR_BOOL swar_digit_pairs(CLIPAR_UINT64 word, CLIPAR_UINT64 digit_mask, CLIPAR_UINT64 separators, CLIPAR_UINT64 *pairs)
+{
+    const CLIPAR_UINT64 zeros = 0x3030303030303030ULL;
+    if (((word ^ separators) & ~digit_mask) != 0) {
         return false;
     }
-    if ((val < min) || (val > max)) {
+    /* Put '0' in the separator lanes, then check every lane is in '0'..'9'. */
+    CLIPAR_UINT64 v = (word & digit_mask) | (zeros & ~digit_mask);
+    if (!swar_is_eight_digits(v)) {
         return false;
     }
-    if (out != NULL) {
-        *out = (CLIPAR_INT)val;
-    }
+    CLIPAR_UINT64 d = v - zeros;
+    *pairs = (d * 10) + (d >> 8);
     return true;
 }
 
 /**
- * @brief Parses a string option by comparing it against an array of valid options.
+ * @brief Checks for an ASCII digit without going through the locale-aware ctype tables.
+ */
+#define IS_DIGIT(c) ((unsigned char)((unsigned char)(c) - '0') < 10u)
+
+/**
+ * @brief Extracts lane i of a SWAR word.
+ */
+#define SWAR_LANE(w, i) ((CLIPAR_UINT)(((w) >> (8 * (i))) & 0xFFu))
+
+/**
+ * @brief Converts a proleptic Gregorian calendar date to days since 1970-01-01.
  *
- * @param arg The input string.
- * @param options Array of valid options.
- * @param num_options Number of elements in the options array.
- * @param out_index Pointer to store the index of the matching option.
- * @return CLIPAR_BOOL true if a matching option is found; false otherwise.
+ * Counts years from March, so the leap day is the last day of the counted year, and
+ * offsets them by 400 so that year 0 stays positive. Everything then fits unsigned 32-bit
+ * arithmetic with constant divisors, and no libc time functions are needed.
+ *
+ * @param y Year (0-9999).
+ * @param m Month (1-12).
+ * @param d Day of month (1-31).
+ * @return CLIPAR_INT64 Days relative to the Unix epoch.
  */
-CLIPAR_BOOL parse_string_option(const CLIPAR_CHAR *arg, const CLIPAR_CHAR *options[], CLIPAR_SIZE_T num_options, CLIPAR_UINT *out_index)
+static CLIPAR_INT64 days_from_civil(CLIPAR_UINT y, CLIPAR_UINT m, CLIPAR_UINT d)
 {
-    if (arg == NULL) {
-        return false;
+    /* Day of the March-based year on which each month starts. */
+    static const unsigned short month_start[12] = { 306, 337, 0, 31, 61, 92, 122, 153, 184, 214, 245, 275 };
+    /* Value of the count below for 1970-01-01. */
+    const CLIPAR_UINT32 epoch = 865565u;
+    const CLIPAR_UINT32 years = (CLIPAR_UINT32)y + 400u - ((m <= 2) ? 1u : 0u);
+    const CLIPAR_UINT32 days = (years * 365u) + (years / 4u) - (years / 100u) + (years / 400u) +
+                               month_start[m - 1] + (CLIPAR_UINT32)d - 1u;
+    return (CLIPAR_INT64)days - (CLIPAR_INT64)epoch;
+}
+
+/**
+ * @brief Returns the number of days in the given month.
+ *
+ * @param y Year.
+ * @param m Month (1-12).
+ * @return CLIPAR_UINT Number of days.
+ */
+static CLIPAR_UINT days_in_month(CLIPAR_UINT y, CLIPAR_UINT m)
+{
+    static const unsigned char mdays[12] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+    if ((m == 2) && ((y % 4) == 0) && (((y % 100) != 0) || ((y % 400) == 0))) {
+        return 29;
     }
-    for (CLIPAR_SIZE_T i = 0; i < num_options; i++) {
-        if (strcmp(arg, options[i]) == 0) {
-            if (out_index != NULL) {
-                *out_index = (CLIPAR_UINT)i;
-            }
-            return true;
-        }
+    return mdays[m - 1];
+}
+
+/**
+ * @brief A unit suffix and its multiplier, stored in a perfect-hash slot.
+ */
+typedef struct {
+    CLIPAR_CHAR name[4];
+    CLIPAR_UINT64 mult;
+} unit_entry_t;
+
+/* Longest unit suffix accepted by the duration and size parsers ("kib"). */
+#define UNIT_MAX_LEN 3u
+
+/**
+ * @brief Perfect hash over unit suffixes: first char, last char times a per-table factor, and length.
+ */
+#define UNIT_HASH(s, len, factor, mask) \
+    ((((CLIPAR_UINT)(unsigned char)(s)[0]) + ((CLIPAR_UINT)(unsigned char)(s)[(len) - 1] * (factor)) + (CLIPAR_UINT)(len)) & (mask))
+
+/* Duration suffixes in nanoseconds. Slots are placed by UNIT_HASH(name, len, 0, 15). */
+#define DURATION_UNIT_FACTOR 0u
+#define DURATION_UNIT_MASK   15u
+static const unit_entry_t duration_units[16] = {
+    { "ns", 1ULL },
+    { "", 0 },
+    { "", 0 },
+    { "", 0 },
+    { "s", 1000000000ULL },
+    { "d", 86400000000000ULL },
+    { "", 0 },
+    { "us", 1000ULL },
+    { "", 0 },
+    { "h", 3600000000000ULL },
+    { "", 0 },
+    { "", 0 },
+    { "", 0 },
+    { "", 0 },
+    { "m", 60000000000ULL },
+    { "ms", 1000000ULL },
+};
+
+/* Size suffixes in bytes (lower case). Bare letters and "*ib" are binary, "*b" is decimal.
+ * Slots are placed by UNIT_HASH(name, len, 30, 31).
+ */
+#define SIZE_UNIT_FACTOR 30u
+#define SIZE_UNIT_MASK   31u
+static const unit_entry_t size_units[32] = {
+    { "", 0 },
+    { "", 0 },
+    { "", 0 },
+    { "eb", 1000000000000000000ULL },
+    { "eib", 1ULL << 60 },
+    { "gb", 1000000000ULL },
+    { "gib", 1ULL << 30 },
+    { "", 0 },
+    { "", 0 },
+    { "kb", 1000ULL },
+    { "kib", 1ULL << 10 },
+    { "mb", 1000000ULL },
+    { "mib", 1ULL << 20 },
+    { "t", 1ULL << 40 },
+    { "pb", 1000000000000000ULL },
+    { "pib", 1ULL << 50 },
+    { "", 0 },
+    { "p", 1ULL << 50 },
+    { "tb", 1000000000000ULL },
+    { "tib", 1ULL << 40 },
+    { "m", 1ULL << 20 },
+    { "", 0 },
+    { "k", 1ULL << 10 },
+    { "", 0 },
+    { "", 0 },
+    { "", 0 },
+    { "g", 1ULL << 30 },
+    { "", 0 },
+    { "e", 1ULL << 60 },
+    { "", 0 },
+    { "", 0 },
+    { "b", 1ULL },
+};
+
+/**
+ * @brief Resolves a unit suffix through a perfect-hash table.
+ *
+ * @param table The unit table.
+ * @param factor The table's last-character hash factor.
+ * @param mask The table's slot mask (size - 1).
+ * @param unit The unit text (not NUL-terminated).
+ * @param len Length of the unit text (1 to UNIT_MAX_LEN).
+ * @return CLIPAR_UINT64 The unit multiplier, or 0 if the unit is unknown.
+ */
+static CLIPAR_UINT64 lookup_unit(const unit_entry_t *table, CLIPAR_UINT factor, CLIPAR_UINT mask, const CLIPAR_CHAR *unit, CLIPAR_SIZE_T len)
+{
+    const unit_entry_t *e = &table[UNIT_HASH(unit, len, factor, mask)];
+    if ((strlen(e->name) != len) || (memcmp(e->name, unit, len) != 0)) {
+        return 0;
     }
-    return false;
+    return e->mult;
 }
 
 /**
- * @brief Validates that the input string is a properly formatted IPv4 address.
+ * @brief Scans one "<digits>[.<digits>][unit]" quantity and advances the cursor past it.
  *
- * The IPv4 address must be in the format "X.X.X.X" where each X is an integer between 0 and 255.
- * A fixed-size stack buffer is used to avoid dynamic memory allocation.
+ * Up to nine fraction digits are kept; further fraction digits are validated and dropped.
+ * The unit is the run of letters that follows, at most UNIT_MAX_LEN long, and is
+ * optionally folded to lower case.
  *
- * @param arg The input IPv4 address string.
- * @return CLIPAR_BOOL true if valid; false otherwise.
+ * @param pp Pointer to the cursor.
+ * @param whole Pointer to store the integer part.
+ * @param frac Pointer to store the kept fraction digits as an integer.
+ * @param frac_scale Pointer to store 10^(number of kept fraction digits).
+ * @param unit Buffer to store the unit text.
+ * @param unit_len Pointer to store the unit length (0 if there is none).
+ * @param fold_case Whether to fold the unit to lower case.
+ * @return CLIPAR_BOOL true if a well-formed quantity was scanned; false otherwise.
  */
-CLIPAR_BOOL parse_ip_address(const CLIPAR_CHAR *arg)
+static CLIPAR_BOOL scan_quantity(const CLIPAR_CHAR **pp, CLIPAR_UINT64 *whole, CLIPAR_UINT64 *frac, CLIPAR_UINT64 *frac_scale,
+                                 CLIPAR_CHAR unit[UNIT_MAX_LEN], CLIPAR_SIZE_T *unit_len, CLIPAR_BOOL fold_case)
 {
-    if ((arg == NULL) || (*arg == '\0')) {
+    const CLIPAR_CHAR *p = *pp;
+    CLIPAR_UINT64 w = 0;
+    CLIPAR_UINT64 f = 0;
+    CLIPAR_UINT64 scale = 1;
+
+    if (!IS_DIGIT(*p)) {
         return false;
     }
-    if (strlen(arg) > 15) {
-        return false;
+    for (; IS_DIGIT(*p); ++p) {
+        CLIPAR_UINT64 d = (CLIPAR_UINT64)(*p - '0');
+        if (w > ((UINT64_MAX - d) / 10)) {
+            return false;
+        }
+        w = (w * 10) + d;
     }
-    char ip_copy[16];
-    strcpy(ip_copy, arg);
-    
-    CLIPAR_INT count = 0;
-    CLIPAR_BOOL valid = true;
-    char *token = strtok(ip_copy, ".");
-    while (token != NULL) {
-        if (!is_digits(token)) {
-            valid = false;
-            break;
+    if (*p == '.') {
+        p++;
+        if (!IS_DIGIT(*p)) {
+            return false;
         }
-        long part = strtol(token, NULL, 10);
-        if ((part < 0) || (part > 255)) {
-            valid = false;
-            break;
+        for (; IS_DIGIT(*p); ++p) {
+            if (scale < 1000000000ULL) {
+                f = (f * 10) + (CLIPAR_UINT64)(*p - '0');
+                scale *= 10;
+            }
         }
-        count++;
-        token = strtok(NULL, ".");
     }
-    if (count != 4) {
-        valid = false;
+
+    CLIPAR_SIZE_T n = 0;
+    for (; ((*p >= 'a') && (*p <= 'z')) || ((*p >= 'A') && (*p <= 'Z')); ++p) {
+        if (n == UNIT_MAX_LEN) {
+            return false;
+        }
+        CLIPAR_CHAR c = *p;
+        if (fold_case && (c >= 'A') && (c <= 'Z')) {
+            c = c + ('a' - 'A');
+        }
+        unit[n++] = c;
     }
-    return valid;
+
+    *whole = w;
+    *frac = f;
+    *frac_scale = scale;
+    *unit_len = n;
+    *pp = p;
+    return true;
 }
 
 /**
- * @brief Validates that the input string is a properly formatted IPv4 address with netmask.
+ * @brief Computes (whole + frac / frac_scale) * mult with integer math, truncating toward zero.
  *
- * Expects the format "X.X.X.X/Y", where "X.X.X.X" is a valid IPv4 address and Y is an integer between 0 and 32.
- *
- * @param arg The input string.
- * @return CLIPAR_BOOL true if valid; false otherwise.
+ * @param whole Integer part.
+ * @param frac Fraction numerator (less than frac_scale).
+ * @param frac_scale Fraction denominator (a power of ten, at most 10^9).
+ * @param mult Unit multiplier.
+ * @param out Pointer to store the result.
+ * @return CLIPAR_BOOL true if the result fits in 64 bits; false on overflow.
  */
-CLIPAR_BOOL parse_ip_address_with_netmask(const CLIPAR_CHAR *arg)
+static CLIPAR_BOOL scale_quantity(CLIPAR_UINT64 whole, CLIPAR_UINT64 frac, CLIPAR_UINT64 frac_scale, CLIPAR_UINT64 mult, CLIPAR_UINT64 *out)
 {
-    if ((arg == NULL) || (*arg == '\0')) {
-        return false;
-    }
-    const CLIPAR_CHAR *slash = strchr(arg, '/');
-    if (slash == NULL) {
-        return false;
-    }
-    CLIPAR_SIZE_T ip_len = (CLIPAR_SIZE_T)(slash - arg);
-    if ((ip_len == 0) || (ip_len > 15)) {
-        return false;
-    }
-    char ip_part[16];
-    memcpy(ip_part, arg, ip_len);
-    ip_part[ip_len] = '\0';
-    
-    if (!parse_ip_address(ip_part)) {
-        return false;
-    }
-    
-    const CLIPAR_CHAR *netmask_part = slash + 1;
-    if ((*netmask_part) == '\0') {
-        return false;
-    }
-    if (!is_digits(netmask_part)) {
-        return false;
-    }
-    char *endptr = NULL;
-    long netmask = strtol(netmask_part, &endptr, 10);
-    if (*endptr != '\0') {
+    if ((whole != 0) && (whole > (UINT64_MAX / mult))) {
         return false;
     }
-    if ((netmask < 0) || (netmask > 32)) {
+    CLIPAR_UINT64 val = whole * mult;
+    /* frac * mult / frac_scale, split so that no intermediate product overflows. */
+    CLIPAR_UINT64 part = ((mult / frac_scale) * frac) + (((mult % frac_scale) * frac) / frac_scale);
+    if (part > (UINT64_MAX - val)) {
         return false;
     }
+    *out = val + part;
     return true;
 }
 
+/* Text layout of a UUID: 8-4-4-4-12 hex digits separated by dashes. */
+#define UUID_TEXT_LEN 36u
+
+#if !CLIPAR_USE_SSSE3
 /**
- * @brief Parses a boolean value from a string.
- *
- * Accepts case-insensitive "true", "1", "yes" for true and "false", "0", "no" for false.
+ * @brief Byte to hexadecimal digit value lookup table (0xFF for non-hex bytes).
+ */
+static const unsigned char hex_value[256] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 10, 11, 12, 13, 14, 15, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 10, 11, 12, 13, 14, 15, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
+/**
+ * @brief Decodes a 36-character UUID body into 16 bytes using table lookups.
  *
- * @param arg The input string.
- * @param out Pointer to store the parsed boolean value.
- * @return CLIPAR_BOOL true if the string represents a valid boolean; false otherwise.
+ * @param s Pointer to the first of UUID_TEXT_LEN characters.
+ * @param out Buffer to store the 16 decoded bytes.
+ * @return CLIPAR_BOOL true if the dashes and hex digits are valid; false otherwise.
  */
-CLIPAR_BOOL parse_bool(const CLIPAR_CHAR *arg, CLIPAR_BOOL *out)
+static CLIPAR_BOOL uuid_decode_scalar(const CLIPAR_CHAR *s, CLIPAR_UINT8 out[16])
 {
-    if (arg == NULL) {
+    static const unsigned char hex_pos[32] = {
+        0, 1, 2, 3, 4, 5, 6, 7, 9, 10, 11, 12, 14, 15, 16, 17,
+        19, 20, 21, 22, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35
+    };
+    if ((s[8] != '-') || (s[13] != '-') || (s[18] != '-') || (s[23] != '-')) {
         return false;
     }
-    if (iequals(arg, "true") || iequals(arg, "1") || iequals(arg, "yes")) {
-        if (out != NULL) {
-            *out = true;
-        }
-        return true;
-    }
-    if (iequals(arg, "false") || iequals(arg, "0") || iequals(arg, "no")) {
-        if (out != NULL) {
-            *out = false;
-        }
-        return true;
+    unsigned int bad = 0;
+    for (CLIPAR_SIZE_T i = 0; i < 16; i++) {
+        unsigned int hi = hex_value[(unsigned char)s[hex_pos[2 * i]]];
+        unsigned int lo = hex_value[(unsigned char)s[hex_pos[(2 * i) + 1]]];
+        bad |= (hi | lo) & 0xF0u;
+        out[i] = (CLIPAR_UINT8)((hi << 4) | (lo & 0x0Fu));
     }
-    return false;
+    return (bad == 0);
 }
+#endif
 
+#if CLIPAR_USE_SSSE3
 /**
- * @brief Parses a floating point number from a string and validates its range.
+ * @brief Converts 16 ASCII hex digits to nibble values with SSE compares.
  *
- * @param arg The input string.
- * @param min Minimum allowed value.
- * @param max Maximum allowed value.
- * @param out Pointer to store the parsed float.
- * @return CLIPAR_BOOL true if successful and within range; false otherwise.
+ * @param v The 16 characters.
+ * @param valid Pointer to a mask that is cleared in lanes holding a non-hex character.
+ * @return __m128i The 16 nibble values.
  */
-CLIPAR_BOOL parse_float_in_range(const CLIPAR_CHAR *arg, CLIPAR_FLOAT min, CLIPAR_FLOAT max, CLIPAR_FLOAT *out)
+static __m128i hex_nibbles_sse(__m128i v, __m128i *valid)
 {
-    if ((arg == NULL) || (*arg == '\0')) {
-        return false;
+    const __m128i d = _mm_sub_epi8(v, _mm_set1_epi8('0'));
+    const __m128i l = _mm_sub_epi8(_mm_or_si128(v, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+    const __m128i is_digit = _mm_cmpeq_epi8(_mm_min_epu8(d, _mm_set1_epi8(9)), d);
+    const __m128i is_alpha = _mm_cmpeq_epi8(_mm_min_epu8(l, _mm_set1_epi8(5)), l);
+    *valid = _mm_and_si128(*valid, _mm_or_si128(is_digit, is_alpha));
+    return _mm_or_si128(_mm_and_si128(is_digit, d),
+                        _mm_and_si128(is_alpha, _mm_add_epi8(l, _mm_set1_epi8(10))));
+}
+
+/**
+ * @brief Decodes a 36-character UUID body into 16 bytes with SSSE3.
+ *
+ * The 32 hex digits are gathered out of three overlapping 16-byte loads with pshufb,
+ * converted to nibbles in two registers and packed pairwise with pmaddubsw.
+ *
+ * @param s Pointer to the first of UUID_TEXT_LEN characters.
+ * @param out Buffer to store the 16 decoded bytes.
+ * @return CLIPAR_BOOL true if the dashes and hex digits are valid; false otherwise.
+ */
+static CLIPAR_BOOL uuid_decode_ssse3(const CLIPAR_CHAR *s, CLIPAR_UINT8 out[16])
+{
+    const __m128i a = _mm_loadu_si128((const __m128i *)(const void *)s);
+    const __m128i b = _mm_loadu_si128((const __m128i *)(const void *)(s + 16));
+    const __m128i c = _mm_loadu_si128((const __m128i *)(const void *)(s + 20));
+
+    /* Dashes at 8 and 13 (in a) and at 18 and 23 (lanes 2 and 7 of b). */
+    const __m128i dash = _mm_set1_epi8('-');
+    if (((_mm_movemask_epi8(_mm_cmpeq_epi8(a, dash)) & 0x2100) != 0x2100) ||
+        ((_mm_movemask_epi8(_mm_cmpeq_epi8(b, dash)) & 0x0084) != 0x0084)) {
+        return false;
+    }
+
+    /* Gather hex digits 0-15 (text 0-7, 9-12, 14-17) and 16-31 (text 19-22, 24-35). */
+    const __m128i lo_chars = _mm_or_si128(
+        _mm_shuffle_epi8(a, _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 9, 10, 11, 12, 14, 15, -1, -1)),
+        _mm_shuffle_epi8(b, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 1)));
+    const __m128i hi_chars = _mm_or_si128(
+        _mm_shuffle_epi8(b, _mm_setr_epi8(3, 4, 5, 6, 8, 9, 10, 11, 12, 13, 14, 15, -1, -1, -1, -1)),
+        _mm_shuffle_epi8(c, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 12, 13, 14, 15)));
+
+    __m128i valid = _mm_set1_epi8(-1);
+    const __m128i lo_nib = hex_nibbles_sse(lo_chars, &valid);
+    const __m128i hi_nib = hex_nibbles_sse(hi_chars, &valid);
+    if (_mm_movemask_epi8(valid) != 0xFFFF) {
+        return false;
+    }
+
+    /* Each byte pair (high nibble, low nibble) becomes 16 * high + low. */
+    const __m128i weights = _mm_set1_epi16(0x0110);
+    const __m128i bytes = _mm_packus_epi16(_mm_maddubs_epi16(lo_nib, weights),
+                                           _mm_maddubs_epi16(hi_nib, weights));
+    _mm_storeu_si128((__m128i *)(void *)out, bytes);
+    return true;
+}
+#endif
+
+/**
+ * @brief Byte to sextet lookup tables for the standard ("+/") and URL-safe ("-_") base64 alphabets.
+ *
+ * Bytes outside the alphabet map to 0xFF. The padding character '=' is handled separately.
+ */
+static const unsigned char base64_std_value[256] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 62, 0xFF, 0xFF, 0xFF, 63,
+    52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14,
+    15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,
+    41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
+static const unsigned char base64_url_value[256] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 62, 0xFF, 0xFF,
+    52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14,
+    15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 0xFF, 0xFF, 0xFF, 0xFF, 63,
+    0xFF, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,
+    41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
+#if CLIPAR_USE_SSSE3
+/**
+ * @brief Mask of lanes whose byte lies in [lo, hi] (unsigned).
+ */
+static __m128i in_range_epu8(__m128i v, char lo, char hi)
+{
+    const __m128i d = _mm_sub_epi8(v, _mm_set1_epi8(lo));
+    return _mm_cmpeq_epi8(_mm_min_epu8(d, _mm_set1_epi8((char)(hi - lo))), d);
+}
+
+/**
+ * @brief Decodes 16 base64 characters into 12 bytes with SSSE3.
+ *
+ * Each lane is classified with range compares and shifted to its sextet value, then the
+ * sextets are merged with pmaddubsw/pmaddwd and compacted with pshufb. 16 bytes are stored,
+ * so the output buffer needs 4 bytes of slack past the 12 decoded ones.
+ *
+ * @param in Pointer to 16 input characters.
+ * @param out Buffer with at least 16 writable bytes.
+ * @param c62 Alphabet character for value 62 ('+' or '-').
+ * @param c63 Alphabet character for value 63 ('/' or '_').
+ * @return CLIPAR_BOOL true if all 16 characters are in the alphabet; false otherwise.
+ */
+static CLIPAR_BOOL base64_decode_block_ssse3(const CLIPAR_CHAR *in, CLIPAR_UINT8 *out, char c62, char c63)
+{
+    const __m128i v = _mm_loadu_si128((const __m128i *)(const void *)in);
+    const __m128i upper = in_range_epu8(v, 'A', 'Z');
+    const __m128i lower = in_range_epu8(v, 'a', 'z');
+    const __m128i digit = in_range_epu8(v, '0', '9');
+    const __m128i is62 = _mm_cmpeq_epi8(v, _mm_set1_epi8(c62));
+    const __m128i is63 = _mm_cmpeq_epi8(v, _mm_set1_epi8(c63));
+    const __m128i valid = _mm_or_si128(_mm_or_si128(upper, lower), _mm_or_si128(digit, _mm_or_si128(is62, is63)));
+    if (_mm_movemask_epi8(valid) != 0xFFFF) {
+        return false;
+    }
+    __m128i shift = _mm_and_si128(upper, _mm_set1_epi8((char)(0 - 'A')));
+    shift = _mm_or_si128(shift, _mm_and_si128(lower, _mm_set1_epi8((char)(26 - 'a'))));
+    shift = _mm_or_si128(shift, _mm_and_si128(digit, _mm_set1_epi8((char)(52 - '0'))));
+    shift = _mm_or_si128(shift, _mm_and_si128(is62, _mm_set1_epi8((char)(62 - c62))));
+    shift = _mm_or_si128(shift, _mm_and_si128(is63, _mm_set1_epi8((char)(63 - c63))));
+    const __m128i sextets = _mm_add_epi8(v, shift);
+
+    /* [a b c d] -> a << 18 | b << 12 | c << 6 | d in each dword, then keep bytes 2, 1, 0. */
+    const __m128i pairs = _mm_maddubs_epi16(sextets, _mm_set1_epi32(0x01400140));
+    const __m128i words = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+    const __m128i bytes = _mm_shuffle_epi8(words, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+    _mm_storeu_si128((__m128i *)(void *)out, bytes);
+    return true;
+}
+#endif
+
+/**
+ * @brief Decodes complete, unpadded 4-character groups until one is invalid.
+ *
+ * Uses 16-character SIMD blocks while at least 16 bytes of output space remain, then
+ * one table lookup per character. Stops at the first group containing a character
+ * outside the alphabet (including '='), leaving it for the caller.
+ *
+ * @param in Input characters.
+ * @param nquads Number of 4-character groups available.
+ * @param out Output buffer with room for at least 3 * nquads bytes.
+ * @param out_cap Total writable bytes at out.
+ * @param url_safe Whether to use the URL-safe alphabet.
+ * @return CLIPAR_SIZE_T Number of groups decoded.
+ */
+static CLIPAR_SIZE_T base64_decode_quads(const CLIPAR_CHAR *in, CLIPAR_SIZE_T nquads, CLIPAR_UINT8 *out, CLIPAR_SIZE_T out_cap, CLIPAR_BOOL url_safe)
+{
+    const unsigned char *table = url_safe ? base64_url_value : base64_std_value;
+    CLIPAR_SIZE_T q = 0;
+#if CLIPAR_USE_SSSE3
+    const char c62 = url_safe ? '-' : '+';
+    const char c63 = url_safe ? '_' : '/';
+    while (((nquads - q) >= 4) && ((out_cap - (3 * q)) >= 16)) {
+        if (!base64_decode_block_ssse3(in + (4 * q), out + (3 * q), c62, c63)) {
+            break;
+        }
+        q += 4;
+    }
+#else
+    (void)out_cap;
+#endif
+    for (; q < nquads; q++) {
+        const unsigned char *s = (const unsigned char *)in + (4 * q);
+        unsigned int a = table[s[0]];
+        unsigned int b = table[s[1]];
+        unsigned int c = table[s[2]];
+        unsigned int d = table[s[3]];
+        if (((a | b | c | d) & 0x80u) != 0) {
+            break;
+        }
+        CLIPAR_UINT32 v = ((CLIPAR_UINT32)a << 18) | ((CLIPAR_UINT32)b << 12) | ((CLIPAR_UINT32)c << 6) | (CLIPAR_UINT32)d;
+        out[3 * q] = (CLIPAR_UINT8)(v >> 16);
+        out[(3 * q) + 1] = (CLIPAR_UINT8)(v >> 8);
+        out[(3 * q) + 2] = (CLIPAR_UINT8)v;
+    }
+    return q;
+}
+
+/**
+ * @brief Emits the bytes of a final group that has 2 or 3 sextets.
+ *
+ * Rejects groups whose unused low bits are not zero, so that every byte string has
+ * exactly one accepted encoding.
+ *
+ * @param st The decoder state.
+ * @param out Buffer with room for st->pending - 1 bytes.
+ * @return CLIPAR_SIZE_T Number of bytes written, or 0 if the group is invalid.
+ */
+static CLIPAR_SIZE_T base64_emit_tail(const base64_stream_t *st, CLIPAR_UINT8 *out)
+{
+    if (st->pending == 2) {
+        if ((st->quad & 0x0Fu) != 0) {
+            return 0;
+        }
+        out[0] = (CLIPAR_UINT8)(st->quad >> 4);
+        return 1;
+    }
+    if ((st->pending == 3) && ((st->quad & 0x03u) == 0)) {
+        out[0] = (CLIPAR_UINT8)(st->quad >> 10);
+        out[1] = (CLIPAR_UINT8)(st->quad >> 2);
+        return 2;
+    }
+    return 0;
+}
+
+/**
+ * @brief Converts a run of digits in the given base to a 64-bit value in a single pass.
+ *
+ * Validation, conversion and overflow detection share one loop, so callers do not need a
+ * separate character check before converting. Scanning stops at the first character that
+ * is not a digit in the base; the caller decides whether anything may follow.
+ *
+ * @param str The input string.
+ * @param base 10 or 16.
+ * @param end Pointer to store the position of the first unconsumed character.
+ * @param out Pointer to store the converted value.
+ * @return CLIPAR_BOOL true if at least one digit was read and the value fits in 64 bits; false otherwise.
+ */
+static CLIPAR_BOOL scan_uint64(const CLIPAR_CHAR *str, CLIPAR_UINT base, const CLIPAR_CHAR **end, CLIPAR_UINT64 *out)
+{
+    const CLIPAR_UINT64 limit = UINT64_MAX / base;
+    const CLIPAR_CHAR *p = str;
+    CLIPAR_UINT64 val = 0;
+    for (;; ++p) {
+        unsigned int c = (unsigned char)*p;
+        unsigned int d;
+        if ((c - '0') < 10u) {
+            d = c - '0';
+        } else if ((base == 16) && (((c | 0x20u) - 'a') < 6u)) {
+            d = (c | 0x20u) - 'a' + 10u;
+        } else {
+            break;
+        }
+        if ((val > limit) || ((val * base) > (UINT64_MAX - d))) {
+            return false;
+        }
+        val = (val * base) + d;
+    }
+    if (p == str) {
+        return false;
+    }
+    *end = p;
+    *out = val;
+    return true;
+}
+
+/* Bias that maps signed 64-bit values onto unsigned keys with the same ordering. */
+#define INTERVAL_SIGN_BIAS 0x8000000000000000ULL
+
+/**
+ * @brief Scans an optionally signed magnitude and converts it to an ordered key.
+ *
+ * For signed sets the value is biased by INTERVAL_SIGN_BIAS so that unsigned comparison
+ * of keys matches signed comparison of values.
+ *
+ * @param pp Pointer to the cursor; advanced past the number.
+ * @param is_signed Whether a leading sign is allowed.
+ * @param base 10, 16, or 0 to select 16 when a "0x"/"0X" prefix follows the sign and 10 otherwise.
+ * @param key Pointer to store the ordered key.
+ * @return CLIPAR_BOOL true if a representable number was scanned; false otherwise.
+ */
+static CLIPAR_BOOL scan_interval_key(const CLIPAR_CHAR **pp, CLIPAR_BOOL is_signed, CLIPAR_UINT base, CLIPAR_UINT64 *key)
+{
+    const CLIPAR_CHAR *p = *pp;
+    CLIPAR_BOOL negative = false;
+    CLIPAR_UINT64 mag = 0;
+
+    if (is_signed && ((*p == '-') || (*p == '+'))) {
+        negative = (*p == '-');
+        p++;
+    }
+    const CLIPAR_BOOL hex_prefix = ((p[0] == '0') && ((p[1] == 'x') || (p[1] == 'X')));
+    if (base == 0) {
+        base = hex_prefix ? 16 : 10;
+    }
+    if ((base == 16) && hex_prefix) {
+        p += 2;
+    }
+    if (!scan_uint64(p, base, &p, &mag)) {
+        return false;
+    }
+    if (is_signed) {
+        if (negative ? (mag > INTERVAL_SIGN_BIAS) : (mag >= INTERVAL_SIGN_BIAS)) {
+            return false;
+        }
+        mag = negative ? (INTERVAL_SIGN_BIAS - mag) : (INTERVAL_SIGN_BIAS + mag);
+    }
+    *key = mag;
+    *pp = p;
+    return true;
+}
+
+/**
+ * @brief Converts a biased key back to the signed value it represents.
+ */
+static CLIPAR_INT64 interval_key_to_int64(CLIPAR_UINT64 key)
+{
+    if (key >= INTERVAL_SIGN_BIAS) {
+        return (CLIPAR_INT64)(key - INTERVAL_SIGN_BIAS);
+    }
+    return -(CLIPAR_INT64)(INTERVAL_SIGN_BIAS - key - 1) - 1;
+}
+
+/**
+ * @brief Checks whether a key lies in a compiled interval set.
+ *
+ * Finds the last interval whose lower bound is <= key with a branchless binary search
+ * over the sorted lower bounds, then compares against that interval's upper bound.
+ *
+ * @param set The compiled interval set.
+ * @param key The value as an ordered key.
+ * @return CLIPAR_BOOL true if the key is in the set; false otherwise.
+ */
+static CLIPAR_BOOL interval_set_contains(const interval_set_t *set, CLIPAR_UINT64 key)
+{
+    CLIPAR_SIZE_T n = set->count;
+    if (n == 0) {
+        return false;
+    }
+    const CLIPAR_UINT64 *base = set->lo;
+    while (n > 1) {
+        CLIPAR_SIZE_T half = n / 2;
+        base = (base[half] <= key) ? (base + half) : base;
+        n -= half;
+    }
+    CLIPAR_SIZE_T idx = (CLIPAR_SIZE_T)(base - set->lo);
+    return ((set->lo[idx] <= key) && (key <= set->hi[idx]));
+}
+
+/**
+ * @brief Converts a whole argument to a key and checks it against a set in one pass.
+ *
+ * @param arg The input string.
+ * @param set The compiled interval set; its is_signed flag selects signed parsing.
+ * @param base 10 or 16 (16 also accepts a "0x"/"0X" prefix).
+ * @param key Pointer to store the ordered key.
+ * @return CLIPAR_BOOL true if the argument is a number in the set; false otherwise.
+ */
+static CLIPAR_BOOL parse_key_in_set(const CLIPAR_CHAR *arg, const interval_set_t *set, CLIPAR_UINT base, CLIPAR_UINT64 *key)
+{
+    if ((arg == NULL) || (*arg == '\0') || (set == NULL)) {
+        return false;
+    }
+    const CLIPAR_CHAR *p = arg;
+    if (!scan_interval_key(&p, set->is_signed, base, key) || (*p != '\0')) {
+        return false;
+    }
+    return interval_set_contains(set, *key);
+}
+
+/**
+ * @brief Scans one "value" or "lo-hi" entry of a set specification and the comma after it.
+ *
+ * @param pp Pointer to the current position; advanced past the entry and its comma.
+ * @param is_signed Whether negative values are allowed.
+ * @param lo Pointer to store the lower bound key.
+ * @param hi Pointer to store the upper bound key.
+ * @return CLIPAR_BOOL true if the entry is valid and followed by ',' and another entry, or by the end; false otherwise.
+ */
+static CLIPAR_BOOL scan_interval_entry(const CLIPAR_CHAR **pp, CLIPAR_BOOL is_signed, CLIPAR_UINT64 *lo, CLIPAR_UINT64 *hi)
+{
+    const CLIPAR_CHAR *p = *pp;
+    if (!scan_interval_key(&p, is_signed, 0, lo)) {
+        return false;
+    }
+    *hi = *lo;
+    if (*p == '-') {
+        p++;
+        if (!scan_interval_key(&p, is_signed, 0, hi) || (*hi < *lo)) {
+            return false;
+        }
+    }
+    if (*p == ',') {
+        p++;
+        if (*p == '\0') {
+            return false;
+        }
+    } else if (*p != '\0') {
+        return false;
+    }
+    *pp = p;
+    return true;
+}
+
+/**
+ * @brief Adds [lo, hi] to a set whose intervals are kept sorted and merged.
+ *
+ * Every stored interval that overlaps or touches [lo, hi] is folded into it, so the
+ * count only grows when the new interval is disjoint from all of them.
+ *
+ * @param set The set to extend.
+ * @param lo Lower bound key.
+ * @param hi Upper bound key (hi >= lo).
+ * @return CLIPAR_BOOL true if added; false if a new interval would exceed CLIPAR_INTERVAL_SET_MAX.
+ */
+static CLIPAR_BOOL interval_set_insert(interval_set_t *set, CLIPAR_UINT64 lo, CLIPAR_UINT64 hi)
+{
+    /* Skip intervals that end before lo - 1; hi[first] < lo keeps the + 1 from wrapping. */
+    CLIPAR_SIZE_T first = 0;
+    while ((first < set->count) && (set->hi[first] < lo) && ((set->hi[first] + 1) < lo)) {
+        first++;
+    }
+    /* Absorb intervals that start at or before hi + 1. */
+    CLIPAR_SIZE_T last = first;
+    while ((last < set->count) && ((hi == UINT64_MAX) || (set->lo[last] <= (hi + 1)))) {
+        if (set->lo[last] < lo) {
+            lo = set->lo[last];
+        }
+        if (set->hi[last] > hi) {
+            hi = set->hi[last];
+        }
+        last++;
+    }
+
+    if (first == last) {
+        if (set->count == CLIPAR_INTERVAL_SET_MAX) {
+            return false;
+        }
+        memmove(&set->lo[first + 1], &set->lo[first], (set->count - first) * sizeof(set->lo[0]));
+        memmove(&set->hi[first + 1], &set->hi[first], (set->count - first) * sizeof(set->hi[0]));
+        set->count++;
+    } else if ((last - first) > 1) {
+        memmove(&set->lo[first + 1], &set->lo[last], (set->count - last) * sizeof(set->lo[0]));
+        memmove(&set->hi[first + 1], &set->hi[last], (set->count - last) * sizeof(set->hi[0]));
+        set->count -= (last - first) - 1;
+    }
+    set->lo[first] = lo;
+    set->hi[first] = hi;
+    return true;
+}
+
+/**
+ * @brief Rebuilds a set from a validated specification one merged interval at a time.
+ *
+ * Used when incremental merging runs out of room although later entries might still
+ * join the intervals. Each merged interval starts at the lowest entry not yet covered and
+ * grows until no entry overlaps or touches its end, so only the final intervals are ever
+ * stored. Rescans the specification, which is fine for the rare sets that need it.
+ *
+ * @param spec The set specification, already checked with scan_interval_entry().
+ * @param set The set to fill; is_signed must already be set.
+ * @return CLIPAR_BOOL true if the merged intervals fit; false otherwise.
+ */
+static CLIPAR_BOOL interval_set_sweep(const CLIPAR_CHAR *spec, interval_set_t *set)
+{
+    const CLIPAR_CHAR *p = NULL;
+    CLIPAR_UINT64 lo = 0;
+    CLIPAR_UINT64 hi = 0;
+    CLIPAR_UINT64 floor_key = 0;
+
+    set->count = 0;
+    for (;;) {
+        CLIPAR_BOOL found = false;
+        CLIPAR_UINT64 start = 0;
+        CLIPAR_UINT64 end = 0;
+        for (p = spec; *p != '\0';) {
+            (void)scan_interval_entry(&p, set->is_signed, &lo, &hi);
+            if ((hi >= floor_key) && (!found || (lo < start))) {
+                found = true;
+                start = lo;
+                end = hi;
+            }
+        }
+        if (!found) {
+            return true;
+        }
+        CLIPAR_BOOL grown = true;
+        while (grown) {
+            grown = false;
+            for (p = spec; *p != '\0';) {
+                (void)scan_interval_entry(&p, set->is_signed, &lo, &hi);
+                if ((hi > end) && (lo <= (end + 1))) {
+                    end = hi;
+                    grown = true;
+                }
+            }
+        }
+
+        if (set->count == CLIPAR_INTERVAL_SET_MAX) {
+            return false;
+        }
+        set->lo[set->count] = start;
+        set->hi[set->count] = end;
+        set->count++;
+        if (end == UINT64_MAX) {
+            return true;
+        }
+        floor_key = end + 1;
+    }
+}
+
+/* Service name table layout: CHD-style perfect hash (bucket displacement, then slot). */
+#define SERVICE_NAME_MAX 16u
+#define SERVICE_BUCKETS  64u
+#define SERVICE_SLOTS    128u
+
+/**
+ * @brief A well-known service name and its IANA port number.
+ */
+typedef struct {
+    CLIPAR_CHAR name[SERVICE_NAME_MAX];
+    CLIPAR_UINT32 port;
+} service_entry_t;
+
+/**
+ * @brief Per-bucket hash seeds. A name lives in slot fnv1a32(name, service_disp[fnv1a32(name, 0) % SERVICE_BUCKETS]) % SERVICE_SLOTS.
+ */
+static const unsigned char service_disp[SERVICE_BUCKETS] = {
+    1, 2, 5, 0, 2, 1, 2, 5,
+    1, 5, 5, 0, 8, 1, 0, 3,
+    1, 1, 11, 1, 5, 2, 8, 1,
+    10, 6, 0, 8, 1, 1, 2, 1,
+    3, 2, 1, 0, 14, 2, 7, 1,
+    4, 20, 3, 2, 20, 0, 2, 0,
+    0, 10, 1, 4, 0, 0, 33, 10,
+    0, 0, 1, 5, 1, 1, 5, 6,
+};
+
+/**
+ * @brief Well-known service names from the IANA port registry, placed by perfect hash.
+ *
+ * Generated together with service_disp by test/tools/gen_service_table.js, which holds the
+ * name list. To add a name, edit the list there and run the script with --write; running
+ * it without arguments checks that these tables still match its output.
+ */
+static const service_entry_t service_table[SERVICE_SLOTS] = {
+    { "kerberos-adm", 749 },
+    { "nfs", 2049 },
+    { "bootps", 67 },
+    { "rfb", 5900 },
+    { "vxlan", 4789 },
+    { "submission", 587 },
+    { "", 0 },
+    { "diameter", 3868 },
+    { "ldap", 389 },
+    { "imap", 143 },
+    { "etcd-server", 2380 },
+    { "mongodb", 27017 },
+    { "sip", 5060 },
+    { "netbios-dgm", 138 },
+    { "ssh", 22 },
+    { "epmap", 135 },
+    { "bfd-control", 3784 },
+    { "isakmp", 500 },
+    { "", 0 },
+    { "ftps", 990 },
+    { "snmptrap", 162 },
+    { "ldp", 646 },
+    { "syslog-tls", 6514 },
+    { "socks", 1080 },
+    { "ipfix", 4739 },
+    { "", 0 },
+    { "radius-acct", 1813 },
+    { "ms-wbt-server", 3389 },
+    { "", 0 },
+    { "finger", 79 },
+    { "", 0 },
+    { "radius", 1812 },
+    { "pptp", 1723 },
+    { "openvpn", 1194 },
+    { "mdns", 5353 },
+    { "snmp", 161 },
+    { "", 0 },
+    { "https", 443 },
+    { "postgresql", 5432 },
+    { "ripng", 521 },
+    { "pop3s", 995 },
+    { "rtsp", 554 },
+    { "ftps-data", 989 },
+    { "redis", 6379 },
+    { "xmpp-server", 5269 },
+    { "ftp-data", 20 },
+    { "echo", 7 },
+    { "ftp", 21 },
+    { "netbios-ns", 137 },
+    { "dhcpv6-client", 546 },
+    { "", 0 },
+    { "amqp", 5672 },
+    { "rip", 520 },
+    { "svn", 3690 },
+    { "", 0 },
+    { "daytime", 13 },
+    { "", 0 },
+    { "xmpp-client", 5222 },
+    { "ipp", 631 },
+    { "discard", 9 },
+    { "", 0 },
+    { "", 0 },
+    { "netbios-ssn", 139 },
+    { "llmnr", 5355 },
+    { "docker", 2375 },
+    { "syslog", 514 },
+    { "microsoft-ds", 445 },
+    { "etcd-client", 2379 },
+    { "netconf-tls", 6513 },
+    { "kerberos", 88 },
+    { "tacacs", 49 },
+    { "http", 80 },
+    { "radsec", 2083 },
+    { "sflow", 6343 },
+    { "l2tp", 1701 },
+    { "geneve", 6081 },
+    { "telnet", 23 },
+    { "bgp", 179 },
+    { "", 0 },
+    { "sips", 5061 },
+    { "openflow", 6653 },
+    { "bootpc", 68 },
+    { "mqtt", 1883 },
+    { "imaps", 993 },
+    { "nntp", 119 },
+    { "docker-s", 2376 },
+    { "http-alt", 8080 },
+    { "", 0 },
+    { "www", 80 },
+    { "", 0 },
+    { "ldaps", 636 },
+    { "stun", 3478 },
+    { "gopher", 70 },
+    { "ms-sql-s", 1433 },
+    { "x11", 6000 },
+    { "smtp", 25 },
+    { "", 0 },
+    { "telnets", 992 },
+    { "time", 37 },
+    { "nicname", 43 },
+    { "sunrpc", 111 },
+    { "memcache", 11211 },
+    { "bfd-echo", 3785 },
+    { "irc", 194 },
+    { "", 0 },
+    { "kpasswd", 464 },
+    { "ntp", 123 },
+    { "", 0 },
+    { "auth", 113 },
+    { "smtps", 465 },
+    { "", 0 },
+    { "pop3", 110 },
+    { "dhcpv6-server", 547 },
+    { "ipfixs", 4740 },
+    { "mysql", 3306 },
+    { "domain", 53 },
+    { "xdmcp", 177 },
+    { "printer", 515 },
+    { "tftp", 69 },
+    { "whois", 43 },
+    { "submissions", 465 },
+    { "", 0 },
+    { "router", 520 },
+    { "dns", 53 },
+    { "msdp", 639 },
+    { "ipsec-nat-t", 4500 },
+    { "netconf-ssh", 830 },
+    { "rsync", 873 },
+};
+
+/**
+ * @brief Computes the 32-bit FNV-1a hash of a byte string, with a seed folded into the offset basis.
+ *
+ * @param s The bytes to hash.
+ * @param len Number of bytes.
+ * @param seed Seed value.
+ * @return CLIPAR_UINT32 The hash value.
+ */
+static CLIPAR_UINT32 fnv1a32(const CLIPAR_CHAR *s, CLIPAR_SIZE_T len, CLIPAR_UINT32 seed)
+{
+    CLIPAR_UINT32 h = 2166136261u ^ seed;
+    for (CLIPAR_SIZE_T i = 0; i < len; i++) {
+        h ^= (unsigned char)s[i];
+        h *= 16777619u;
+    }
+    return h;
+}
+
+/**
+ * @brief Two-digit ASCII pairs "00" to "99", used to format two digits per step.
+ */
+static const CLIPAR_CHAR digit_pairs[201] =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+/**
+ * @brief Writes the decimal digits of a value backwards, ending just before end.
+ *
+ * @param end One past the position of the last digit.
+ * @param v The value.
+ * @param min_digits Minimum number of digits; shorter values are zero-padded.
+ * @return CLIPAR_CHAR* Pointer to the first digit written.
+ */
+static CLIPAR_CHAR *write_digits_backward(CLIPAR_CHAR *end, CLIPAR_UINT32 v, CLIPAR_UINT min_digits)
+{
+    CLIPAR_CHAR *p = end;
+    while (v >= 100) {
+        CLIPAR_UINT32 idx = (v % 100) * 2;
+        v /= 100;
+        *--p = digit_pairs[idx + 1];
+        *--p = digit_pairs[idx];
+    }
+    if (v >= 10) {
+        *--p = digit_pairs[(v * 2) + 1];
+        *--p = digit_pairs[v * 2];
+    } else {
+        *--p = (CLIPAR_CHAR)('0' + v);
+    }
+    while ((CLIPAR_UINT)(end - p) < min_digits) {
+        *--p = '0';
+    }
+    return p;
+}
+
+/**
+ * @brief Writes the decimal digits of a 64-bit value backwards, ending just before end.
+ *
+ * @param end One past the position of the last digit.
+ * @param v The value.
+ * @return CLIPAR_CHAR* Pointer to the first digit written.
+ */
+static CLIPAR_CHAR *write_uint64_backward(CLIPAR_CHAR *end, CLIPAR_UINT64 v)
+{
+    CLIPAR_CHAR *p = end;
+    while (v > 0xFFFFFFFFu) {
+        p = write_digits_backward(p, (CLIPAR_UINT32)(v % 1000000000u), 9);
+        v /= 1000000000u;
+    }
+    return write_digits_backward(p, (CLIPAR_UINT32)v, 1);
+}
+
+/**
+ * @brief Writes "A.B.C.D" for an IPv4 address backwards, ending just before end.
+ *
+ * @param end One past the position of the last character.
+ * @param addr The address in host byte order, first octet in the most significant byte.
+ * @return CLIPAR_CHAR* Pointer to the first character written.
+ */
+static CLIPAR_CHAR *write_ipv4_backward(CLIPAR_CHAR *end, CLIPAR_UINT32 addr)
+{
+    CLIPAR_CHAR *p = end;
+    for (CLIPAR_UINT i = 0; i < 4; i++) {
+        if (i != 0) {
+            *--p = '.';
+        }
+        p = write_digits_backward(p, (addr >> (8 * i)) & 0xFFu, 1);
+    }
+    return p;
+}
+
+/**
+ * @brief Copies formatted text and its NUL terminator into a caller buffer.
+ *
+ * @param text The formatted text.
+ * @param len Length of the text, excluding the NUL.
+ * @param buf Output buffer.
+ * @param size Size of the output buffer.
+ * @return CLIPAR_SIZE_T len, or 0 if buf is NULL or too small.
+ */
+static CLIPAR_SIZE_T emit_formatted(const CLIPAR_CHAR *text, CLIPAR_SIZE_T len, CLIPAR_CHAR *buf, CLIPAR_SIZE_T size)
+{
+    if ((buf == NULL) || (size <= len)) {
+        return 0;
+    }
+    memcpy(buf, text, len);
+    buf[len] = '\0';
+    return len;
+}
+
+/**
+ * @brief Computes acc = acc * mul + add on a two-limb 128-bit value.
+ *
+ * The low limb is processed in 32-bit halves so that no partial product exceeds 64 bits.
+ *
+ * @param acc The accumulator.
+ * @param mul Multiplier (non-zero).
+ * @param add Addend.
+ * @return CLIPAR_BOOL true on success; false if the result does not fit in 128 bits.
+ */
+static CLIPAR_BOOL uint128_mul_add(uint128_value_t *acc, CLIPAR_UINT32 mul, CLIPAR_UINT32 add)
+{
+    CLIPAR_UINT64 lo_lo = ((acc->lo & 0xFFFFFFFFu) * mul) + add;
+    CLIPAR_UINT64 lo_hi = ((acc->lo >> 32) * mul) + (lo_lo >> 32);
+    CLIPAR_UINT64 carry = lo_hi >> 32;
+    if (acc->hi > ((UINT64_MAX - carry) / mul)) {
+        return false;
+    }
+    acc->hi = (acc->hi * mul) + carry;
+    acc->lo = (lo_hi << 32) | (lo_lo & 0xFFFFFFFFu);
+    return true;
+}
+
+/**
+ * @brief Returns true if a < b for two-limb 128-bit values.
+ */
+static CLIPAR_BOOL uint128_less(uint128_value_t a, uint128_value_t b)
+{
+    return ((a.hi < b.hi) || ((a.hi == b.hi) && (a.lo < b.lo)));
+}
+
+/**
+ * @brief Converts a decimal or "0x"-prefixed hexadecimal string to a 128-bit value.
+ *
+ * Decimal digits are validated and converted eight at a time with SWAR arithmetic and
+ * folded into the two limbs with one multiply-add per chunk. Hex digits shift four bits
+ * at a time across the limbs. Both paths detect overflow.
+ *
+ * @param str The input string.
+ * @param out Pointer to store the value.
+ * @return CLIPAR_BOOL true if the whole string is a valid number that fits in 128 bits; false otherwise.
+ */
+static CLIPAR_BOOL scan_uint128(const CLIPAR_CHAR *str, uint128_value_t *out)
+{
+    uint128_value_t acc = { 0, 0 };
+    const CLIPAR_CHAR *p = str;
+
+    if ((p[0] == '0') && ((p[1] == 'x') || (p[1] == 'X'))) {
+        p += 2;
+        if (*p == '\0') {
+            return false;
+        }
+        for (; *p != '\0'; ++p) {
+            unsigned int c = (unsigned char)*p;
+            unsigned int d;
+            if ((c - '0') < 10u) {
+                d = c - '0';
+            } else if (((c | 0x20u) - 'a') < 6u) {
+                d = (c | 0x20u) - 'a' + 10u;
+            } else {
+                return false;
+            }
+            if ((acc.hi >> 60) != 0) {
+                return false;
+            }
+            acc.hi = (acc.hi << 4) | (acc.lo >> 60);
+            acc.lo = (acc.lo << 4) | d;
+        }
+    } else {
+        CLIPAR_SIZE_T len = strlen(p);
+        if (len == 0) {
+            return false;
+        }
+        /* Leading len % 8 digits one at a time, then whole 8-digit chunks. */
+        for (CLIPAR_SIZE_T head = len % 8; head > 0; head--, p++) {
+            if (!IS_DIGIT(*p) || !uint128_mul_add(&acc, 10, (CLIPAR_UINT32)(*p - '0'))) {
+                return false;
+            }
+        }
+        for (; *p != '\0'; p += 8) {
+            CLIPAR_UINT64 w = load_le64(p);
+            if (!swar_is_eight_digits(w) || !uint128_mul_add(&acc, 100000000u, swar_eight_digits_value(w))) {
+                return false;
+            }
+        }
+    }
+    *out = acc;
+    return true;
+}
+
+/* Element kinds of a compiled glob segment. */
+#define GLOB_ELEM_LITERAL 0u
+#define GLOB_ELEM_ANY     1u
+#define GLOB_ELEM_CLASS   2u
+
+/**
+ * @brief Checks whether text[0..seg.len) matches one glob segment (no '*' inside).
+ *
+ * The segment's leading literal run is compared with memcmp before the element loop.
+ *
+ * @param g The compiled pattern.
+ * @param seg Index of the segment.
+ * @param text Candidate text, at least as long as the segment.
+ * @return CLIPAR_BOOL true if the segment matches at text; false otherwise.
+ */
+static CLIPAR_BOOL glob_segment_matches(const glob_pattern_t *g, CLIPAR_SIZE_T seg, const CLIPAR_CHAR *text)
+{
+    const CLIPAR_UINT8 first = g->seg_start[seg];
+    const CLIPAR_UINT8 n = g->seg_len[seg];
+    const CLIPAR_UINT8 lit = g->seg_literal_len[seg];
+    if ((lit != 0) && (memcmp(text, g->literals + first, lit) != 0)) {
+        return false;
+    }
+    for (CLIPAR_UINT8 i = lit; i < n; i++) {
+        const unsigned char c = (unsigned char)text[i];
+        const CLIPAR_UINT8 arg = g->elem_arg[first + i];
+        switch (g->elem_kind[first + i]) {
+            case GLOB_ELEM_LITERAL:
+                if (c != arg) {
+                    return false;
+                }
+                break;
+            case GLOB_ELEM_CLASS:
+                if ((g->classes[arg][c >> 3] & (1u << (c & 7u))) == 0) {
+                    return false;
+                }
+                break;
+            default:
+                break;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Finds the leftmost match of a glob segment within text[0..len).
+ *
+ * When the segment starts with a literal byte, candidate positions are located with
+ * memchr, which libc implements with SIMD scans, instead of testing every position.
+ *
+ * @param g The compiled pattern.
+ * @param seg Index of the segment.
+ * @param text The text to search.
+ * @param len Length of the text.
+ * @return const CLIPAR_CHAR* Start of the leftmost match, or NULL if there is none.
+ */
+static const CLIPAR_CHAR *glob_segment_find(const glob_pattern_t *g, CLIPAR_SIZE_T seg, const CLIPAR_CHAR *text, CLIPAR_SIZE_T len)
+{
+    const CLIPAR_SIZE_T n = g->seg_len[seg];
+    if (n > len) {
+        return NULL;
+    }
+    const CLIPAR_CHAR *p = text;
+    const CLIPAR_CHAR *last = text + (len - n);
+    while (p <= last) {
+        if (g->seg_literal_len[seg] != 0) {
+            p = (const CLIPAR_CHAR *)memchr(p, g->literals[g->seg_start[seg]], (CLIPAR_SIZE_T)(last - p) + 1);
+            if (p == NULL) {
+                return NULL;
+            }
+        }
+        if (glob_segment_matches(g, seg, p)) {
+            return p;
+        }
+        p++;
+    }
+    return NULL;
+}
+
+/**
+ * @brief Computes a 64-bit FNV-1a hash of a NUL-terminated string.
+ *
+ * @param s The string.
+ * @param len Pointer to store the string length.
+ * @return CLIPAR_UINT64 The hash value.
+ */
+static CLIPAR_UINT64 fnv1a64(const CLIPAR_CHAR *s, CLIPAR_SIZE_T *len)
+{
+    CLIPAR_UINT64 h = 14695981039346656037ULL;
+    const CLIPAR_CHAR *p = s;
+    for (; *p != '\0'; ++p) {
+        h ^= (unsigned char)*p;
+        h *= 1099511628211ULL;
+    }
+    *len = (CLIPAR_SIZE_T)(p - s);
+    return h;
+}
+
+#if !defined(CLIPAR_NO_OPTION_CACHE)
+/* Option tables smaller than OPTION_INDEX_MIN are faster to scan than to hash. Indexes are
+ * direct-mapped by table address; a slot owned by another table is only rebuilt after
+ * OPTION_INDEX_PATIENCE consecutive misses, about what one rebuild costs in linear scans. */
+#define OPTION_INDEX_TABLES   32u
+#define OPTION_INDEX_SLOTS    256u
+#define OPTION_INDEX_MIN      8u
+#define OPTION_INDEX_MAX      (OPTION_INDEX_SLOTS / 2u)
+#define OPTION_INDEX_PATIENCE 8u
+
+/* Hash index of one option table; slots hold option index + 1, or 0 when empty. */
+typedef struct {
+    const CLIPAR_CHAR **options;
+    const CLIPAR_CHAR *first;
+    const CLIPAR_CHAR *last;
+    CLIPAR_SIZE_T count;
+    CLIPAR_UINT misses;
+    CLIPAR_UINT8 slots[OPTION_INDEX_SLOTS];
+} option_index_t;
+
+static CLIPAR_THREAD_LOCAL option_index_t option_indexes[OPTION_INDEX_TABLES];
+
+/**
+ * @brief Computes a cheap hash of an option string from its length and three sampled bytes.
+ *
+ * Option keywords are short and mostly differ in length or at the ends, so sampling is
+ * enough to spread them; collisions are resolved by probing and strcmp.
+ *
+ * @param s The string.
+ * @return CLIPAR_SIZE_T The slot index in [0, OPTION_INDEX_SLOTS).
+ */
+static CLIPAR_SIZE_T option_hash(const CLIPAR_CHAR *s)
+{
+    const CLIPAR_SIZE_T len = strlen(s);
+    CLIPAR_UINT32 h = (CLIPAR_UINT32)len;
+    if (len != 0) {
+        h |= ((CLIPAR_UINT32)(unsigned char)s[0] << 8) | ((CLIPAR_UINT32)(unsigned char)s[len / 2] << 16) |
+             ((CLIPAR_UINT32)(unsigned char)s[len - 1] << 24);
+    }
+    h *= 0x9E3779B1u;
+    return (CLIPAR_SIZE_T)(h >> 24) & (OPTION_INDEX_SLOTS - 1);
+}
+
+/**
+ * @brief Returns the hash index of an option table, building it when its slot is free or stale.
+ *
+ * Each table maps to one slot by its array address. Tables are identified by the array
+ * pointer, the element count and the first and last element pointers, so a different table
+ * reusing the same stack address is re-indexed. When the slot holds another table, the
+ * caller scans linearly instead, and the slot is only taken over after OPTION_INDEX_PATIENCE
+ * misses in a row; tables that keep colliding therefore cost a scan, not a rebuild per call.
+ * Duplicate options keep the lowest index, as the linear scan would.
+ *
+ * @param options Array of valid options.
+ * @param num_options Number of elements (OPTION_INDEX_MIN to OPTION_INDEX_MAX).
+ * @return const option_index_t* The index for the table, or NULL to use the linear scan.
+ */
+static const option_index_t *option_index_get(const CLIPAR_CHAR *options[], CLIPAR_SIZE_T num_options)
+{
+    const CLIPAR_UINT64 addr = (CLIPAR_UINT64)(uintptr_t)options;
+    option_index_t *idx = &option_indexes[(CLIPAR_SIZE_T)(((addr >> 3) * 0x9E3779B97F4A7C15ULL) >> 40) & (OPTION_INDEX_TABLES - 1)];
+    if ((idx->options == options) && (idx->count == num_options) && (idx->first == options[0]) &&
+        (idx->last == options[num_options - 1])) {
+        idx->misses = 0;
+        return idx;
+    }
+    if ((idx->options != NULL) && (++idx->misses < OPTION_INDEX_PATIENCE)) {
+        return NULL;
+    }
+
+    memset(idx->slots, 0, sizeof(idx->slots));
+    for (CLIPAR_SIZE_T i = 0; i < num_options; i++) {
+        CLIPAR_SIZE_T h = option_hash(options[i]);
+        while ((idx->slots[h] != 0) && (strcmp(options[idx->slots[h] - 1], options[i]) != 0)) {
+            h = (h + 1) & (OPTION_INDEX_SLOTS - 1);
+        }
+        if (idx->slots[h] == 0) {
+            idx->slots[h] = (CLIPAR_UINT8)(i + 1);
+        }
+    }
+    idx->options = options;
+    idx->first = options[0];
+    idx->last = options[num_options - 1];
+    idx->count = num_options;
+    idx->misses = 0;
+    return idx;
+}
+#endif
+
+/**
+ * @brief Scans a dotted-decimal IPv4 address and converts it to host byte order.
+ *
+ * Each of the four octets must be a decimal number of at most 255 (leading zeros allowed), and
+ * the whole address at most 15 characters, matching parse_ip_address().
+ *
+ * @param pp Pointer to the cursor; advanced past the address.
+ * @param addr Pointer to store the address, first octet in the most significant byte.
+ * @return CLIPAR_BOOL true if an address was scanned; false otherwise.
+ */
+static CLIPAR_BOOL scan_ipv4(const CLIPAR_CHAR **pp, CLIPAR_UINT32 *addr)
+{
+    const CLIPAR_CHAR *p = *pp;
+    CLIPAR_UINT32 v = 0;
+    for (CLIPAR_UINT i = 0; i < 4; i++) {
+        if (i != 0) {
+            if (*p != '.') {
+                return false;
+            }
+            p++;
+        }
+        CLIPAR_UINT32 octet = 0;
+        const CLIPAR_CHAR *digits = p;
+        for (; IS_DIGIT(*p); p++) {
+            octet = (octet * 10) + (CLIPAR_UINT32)(*p - '0');
+            if (octet > 255) {
+                return false;
+            }
+        }
+        if (p == digits) {
+            return false;
+        }
+        v = (v << 8) | octet;
+    }
+    if ((p - *pp) > 15) {
+        return false;
+    }
+    *addr = v;
+    *pp = p;
+    return true;
+}
+
+/**
+ * @brief Parses an unsigned 32-bit integer from a string and validates its range.
+ *
+ * @param arg The input string.
+ * @param min Minimum allowed value.
+ * @param max Maximum allowed value.
+ * @param out Pointer to store the parsed value.
+ * @return CLIPAR_BOOL true if successful and within range; false otherwise.
+ */
+CLIPAR_BOOL parse_uint32_in_range(const CLIPAR_CHAR *arg, CLIPAR_UINT32 min, CLIPAR_UINT32 max, CLIPAR_UINT32 *out)
+{
+    if ((arg == NULL) || (*arg == '\0')) {
+        return false;
+    }
+    if (!is_digits(arg)) {
+        return false;
+    }
+    char *endptr = NULL;
+    unsigned long val = strtoul(arg, &endptr, 10);
+    if (*endptr != '\0') {
+        return false;
+    }
+    if ((val < min) || (val > max)) {
+        return false;
+    }
+    if (out != NULL) {
+        *out = (CLIPAR_UINT32)val;
+    }
+    return true;
+}
+
+/**
+ * @brief Parses an unsigned 64-bit integer from a string and validates its range.
+ *
+ * @param arg The input string.
+ * @param min Minimum allowed value.
+ * @param max Maximum allowed value.
+ * @param out Pointer to store the parsed value.
+ * @return CLIPAR_BOOL true if successful and within range; false otherwise.
+ */
+CLIPAR_BOOL parse_uint64_in_range(const CLIPAR_CHAR *arg, CLIPAR_UINT64 min, CLIPAR_UINT64 max, CLIPAR_UINT64 *out)
+{
+    if ((arg == NULL) || (*arg == '\0')) {
+        return false;
+    }
+    if (!is_digits(arg)) {
+        return false;
+    }
+    char *endptr = NULL;
+    unsigned long long val = strtoull(arg, &endptr, 10);
+    if (*endptr != '\0') {
+        return false;
+    }
+    if ((val < min) || (val > max)) {
+        return false;
+    }
+    if (out != NULL) {
+        *out = (CLIPAR_UINT64)val;
+    }
+    return true;
+}
+
+/**
+ * @brief Parses a signed integer from a string and validates its range.
+ *
+ * @param arg The input string.
+ * @param min Minimum allowed value.
+ * @param max Maximum allowed value.
+ * @param out Pointer to store the parsed value.
+ * @return CLIPAR_BOOL true if successful and within range; false otherwise.
+ */
+CLIPAR_BOOL parse_int_in_range(const CLIPAR_CHAR *arg, CLIPAR_INT min, CLIPAR_INT max, CLIPAR_INT *out)
+{
+    if ((arg == NULL) || (*arg == '\0')) {
+        return false;
+    }
+    if (!is_valid_int(arg)) {
+        return false;
+    }
+    char *endptr = NULL;
+    long val = strtol(arg, &endptr, 10);
+    if (*endptr != '\0') {
+        return false;
+    }
+    if ((val < min) || (val > max)) {
+        return false;
+    }
+    if (out != NULL) {
+        *out = (CLIPAR_INT)val;
+    }
+    return true;
+}
+
+/**
+ * @brief Parses a string option by comparing it against an array of valid options.
+ *
+ * Tables of OPTION_INDEX_MIN to OPTION_INDEX_MAX options are looked up through a per-thread
+ * hash index built on the first call with that table, so repeated calls cost about one hash
+ * and one strcmp; tables whose index slot is taken by another table use the linear scan.
+ * The index is not revalidated, so the strings of a table must not change while it is in
+ * use (pass a new array instead). Define CLIPAR_NO_OPTION_CACHE to always use the linear
+ * scan.
+ *
+ * @param arg The input string.
+ * @param options Array of valid options.
+ * @param num_options Number of elements in the options array.
+ * @param out_index Pointer to store the index of the matching option.
+ * @return CLIPAR_BOOL true if a matching option is found; false otherwise.
+ */
+CLIPAR_BOOL parse_string_option(const CLIPAR_CHAR *arg, const CLIPAR_CHAR *options[], CLIPAR_SIZE_T num_options, CLIPAR_UINT *out_index)
+{
+    if (arg == NULL) {
+        return false;
+    }
+#if !defined(CLIPAR_NO_OPTION_CACHE)
+    const option_index_t *idx = NULL;
+    if ((num_options >= OPTION_INDEX_MIN) && (num_options <= OPTION_INDEX_MAX)) {
+        idx = option_index_get(options, num_options);
+    }
+    if (idx != NULL) {
+        CLIPAR_SIZE_T h = option_hash(arg);
+        for (; idx->slots[h] != 0; h = (h + 1) & (OPTION_INDEX_SLOTS - 1)) {
+            const CLIPAR_SIZE_T i = (CLIPAR_SIZE_T)idx->slots[h] - 1;
+            if (strcmp(arg, options[i]) == 0) {
+                if (out_index != NULL) {
+                    *out_index = (CLIPAR_UINT)i;
+                }
+                return true;
+            }
+        }
+        return false;
+    }
+#endif
+    for (CLIPAR_SIZE_T i = 0; i < num_options; i++) {
+        if (strcmp(arg, options[i]) == 0) {
+            if (out_index != NULL) {
+                *out_index = (CLIPAR_UINT)i;
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Validates that the input string is a properly formatted IPv4 address.
+ *
+ * The IPv4 address must be in the format "X.X.X.X" where each X is an integer between 0 and 255.
+ * A fixed-size stack buffer is used to avoid dynamic memory allocation.
+ *
+ * @param arg The input IPv4 address string.
+ * @return CLIPAR_BOOL true if valid; false otherwise.
+ */
+CLIPAR_BOOL parse_ip_address(const CLIPAR_CHAR *arg)
+{
+    if ((arg == NULL) || (*arg == '\0')) {
+        return false;
+    }
+    if (strlen(arg) > 15) {
+        return false;
+    }
+    char ip_copy[16];
+    strcpy(ip_copy, arg);
+    
+    CLIPAR_INT count = 0;
+    CLIPAR_BOOL valid = true;
+    char *token = strtok(ip_copy, ".");
+    while (token != NULL) {
+        if (!is_digits(token)) {
+            valid = false;
+            break;
+        }
+        long part = strtol(token, NULL, 10);
+        if ((part < 0) || (part > 255)) {
+            valid = false;
+            break;
+        }
+        count++;
+        token = strtok(NULL, ".");
+    }
+    if (count != 4) {
+        valid = false;
+    }
+    return valid;
+}
+
+/**
+ * @brief Validates that the input string is a properly formatted IPv4 address with netmask.
+ *
+ * Expects the format "X.X.X.X/Y", where "X.X.X.X" is a valid IPv4 address and Y is an integer between 0 and 32.
+ *
+ * @param arg The input string.
+ * @return CLIPAR_BOOL true if valid; false otherwise.
+ */
+CLIPAR_BOOL parse_ip_address_with_netmask(const CLIPAR_CHAR *arg)
+{
+    if ((arg == NULL) || (*arg == '\0')) {
+        return false;
+    }
+    const CLIPAR_CHAR *slash = strchr(arg, '/');
+    if (slash == NULL) {
+        return false;
+    }
+    CLIPAR_SIZE_T ip_len = (CLIPAR_SIZE_T)(slash - arg);
+    if ((ip_len == 0) || (ip_len > 15)) {
+        return false;
+    }
+    char ip_part[16];
+    memcpy(ip_part, arg, ip_len);
+    ip_part[ip_len] = '\0';
+    
+    if (!parse_ip_address(ip_part)) {
+        return false;
+    }
+    
+    const CLIPAR_CHAR *netmask_part = slash + 1;
+    if ((*netmask_part) == '\0') {
+        return false;
+    }
+    if (!is_digits(netmask_part)) {
+        return false;
+    }
+    char *endptr = NULL;
+    long netmask = strtol(netmask_part, &endptr, 10);
+    if (*endptr != '\0') {
+        return false;
+    }
+    if ((netmask < 0) || (netmask > 32)) {
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Parses an IPv4 address in the format "X.X.X.X" and returns it as a 32-bit value.
+ *
+ * Unlike parse_ip_address(), which only validates, this stores the address in host byte
+ * order (first octet in the most significant byte), the form format_ip_address() takes.
+ * Empty octets, as in "1..2.3" or "1.2.3.4.", are rejected.
+ *
+ * @param arg The input IPv4 address string.
+ * @param out Pointer to store the address.
+ * @return CLIPAR_BOOL true if valid; false otherwise.
+ */
+CLIPAR_BOOL parse_ip_address_value(const CLIPAR_CHAR *arg, CLIPAR_UINT32 *out)
+{
+    CLIPAR_UINT32 addr = 0;
+    if ((arg == NULL) || !scan_ipv4(&arg, &addr) || (*arg != '\0')) {
+        return false;
+    }
+    if (out != NULL) {
+        *out = addr;
+    }
+    return true;
+}
+
+/**
+ * @brief Parses an IPv4 address with netmask in the format "X.X.X.X/Y" and returns both parts.
+ *
+ * The address is stored in host byte order, as for parse_ip_address_value(), and Y must be
+ * between 0 and 32. The results can be passed directly to format_ip_address_with_netmask().
+ *
+ * @param arg The input string.
+ * @param addr Pointer to store the address.
+ * @param prefix_len Pointer to store the prefix length.
+ * @return CLIPAR_BOOL true if valid; false otherwise.
+ */
+CLIPAR_BOOL parse_ip_address_with_netmask_value(const CLIPAR_CHAR *arg, CLIPAR_UINT32 *addr, CLIPAR_UINT *prefix_len)
+{
+    CLIPAR_UINT32 a = 0;
+    CLIPAR_UINT len = 0;
+    if ((arg == NULL) || !scan_ipv4(&arg, &a) || (*arg != '/') || !IS_DIGIT(arg[1])) {
+        return false;
+    }
+    for (arg++; IS_DIGIT(*arg); arg++) {
+        len = (len * 10) + (CLIPAR_UINT)(*arg - '0');
+        if (len > 32) {
+            return false;
+        }
+    }
+    if (*arg != '\0') {
+        return false;
+    }
+    if (addr != NULL) {
+        *addr = a;
+    }
+    if (prefix_len != NULL) {
+        *prefix_len = len;
+    }
+    return true;
+}
+
+/**
+ * @brief Validates that the input string is an RFC 1123 host name.
+ *
+ * The name is checked in a single pass using a byte class table, without regular
+ * expressions or dynamic memory. When allow_ip_literal is true, strings that are not
+ * host names are also accepted if they are valid IPv4 addresses ("X.X.X.X"), checked with
+ * parse_ip_address_value() so that empty octets are rejected and no shared state is used.
+ *
+ * @param arg The input string.
+ * @param allow_ip_literal Whether an IPv4 address literal is also accepted.
+ * @return CLIPAR_BOOL true if valid; false otherwise.
+ */
+CLIPAR_BOOL parse_hostname(const CLIPAR_CHAR *arg, CLIPAR_BOOL allow_ip_literal)
+{
+    if ((arg == NULL) || (*arg == '\0')) {
+        return false;
+    }
+    if (is_rfc1123_hostname(arg)) {
+        return true;
+    }
+    return (allow_ip_literal && parse_ip_address_value(arg, NULL));
+}
+
+/**
+ * @brief Parses a boolean value from a string.
+ *
+ * Accepts case-insensitive "true", "1", "yes" for true and "false", "0", "no" for false.
+ *
+ * @param arg The input string.
+ * @param out Pointer to store the parsed boolean value.
+ * @return CLIPAR_BOOL true if the string represents a valid boolean; false otherwise.
+ */
+CLIPAR_BOOL parse_bool(const CLIPAR_CHAR *arg, CLIPAR_BOOL *out)
+{
+    if (arg == NULL) {
+        return false;
+    }
+    if (iequals(arg, "true") || iequals(arg, "1") || iequals(arg, "yes")) {
+        if (out != NULL) {
+            *out = true;
+        }
+        return true;
+    }
+    if (iequals(arg, "false") || iequals(arg, "0") || iequals(arg, "no")) {
+        if (out != NULL) {
+            *out = false;
+        }
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Parses a floating point number from a string and validates its range.
+ *
+ * @param arg The input string.
+ * @param min Minimum allowed value.
+ * @param max Maximum allowed value.
+ * @param out Pointer to store the parsed float.
+ * @return CLIPAR_BOOL true if successful and within range; false otherwise.
+ */
+CLIPAR_BOOL parse_float_in_range(const CLIPAR_CHAR *arg, CLIPAR_FLOAT min, CLIPAR_FLOAT max, CLIPAR_FLOAT *out)
+{
+    if ((arg == NULL) || (*arg == '\0')) {
+        return false;
+    }
+    char *endptr = NULL;
+    CLIPAR_FLOAT val = strtof(arg, &endptr);
+    if (*endptr != '\0') {
+        return false;
+    }
+    if ((val < min) || (val > max)) {
+        return false;
+    }
+    if (out != NULL) {
+        *out = val;
+    }
+    return true;
+}
+
+/**
+ * @brief Parses a hexadecimal number from a string and validates its range.
+ *
+ * Accepts an optional "0x" or "0X" prefix.
+ *
+ * @param arg The input string.
+ * @param min Minimum allowed value.
+ * @param max Maximum allowed value.
+ * @param out Pointer to store the parsed hexadecimal value.
+ * @return CLIPAR_BOOL true if successful and within range; false otherwise.
+ */
+CLIPAR_BOOL parse_hex_in_range(const CLIPAR_CHAR *arg, CLIPAR_ULONG min, CLIPAR_ULONG max, CLIPAR_ULONG *out)
+{
+    if ((arg == NULL) || (*arg == '\0')) {
+        return false;
+    }
+    if ((arg[0] == '0') && ((arg[1] == 'x') || (arg[1] == 'X'))) {
+        arg += 2;
+    }
+    if (!is_hex_digits(arg)) {
+        return false;
+    }
+    char *endptr = NULL;
+    CLIPAR_ULONG val = strtoul(arg, &endptr, 16);
+    if (*endptr != '\0') {
+        return false;
+    }
+    if ((val < min) || (val > max)) {
+        return false;
+    }
+    if (out != NULL) {
+        *out = val;
+    }
+    return true;
+}
+
+/**
+ * @brief Parses an ISO 8601 / RFC 3339 timestamp into nanoseconds since the Unix epoch.
+ *
+ * Accepts "YYYY-MM-DDTHH:MM:SS[.fraction](Z|+HH:MM|-HH:MM)". The date/time separator may
+ * be 'T', 't' or a space, and 'z' is accepted for UTC. Up to nine fraction digits are
+ * used; further digits are validated and truncated. Leap seconds (":60") are rejected.
+ *
+ * The fixed-position fields are validated and converted eight characters at a time with
+ * SWAR arithmetic, and the calendar date is converted arithmetically, so no locale or
+ * libc time functions are involved.
+ *
+ * @param arg The input string.
+ * @param epoch_ns Pointer to store the parsed time in nanoseconds since 1970-01-01T00:00:00Z.
+ * @return CLIPAR_BOOL true if successful and representable; false otherwise.
+ */
+CLIPAR_BOOL parse_timestamp(const CLIPAR_CHAR *arg, CLIPAR_INT64 *epoch_ns)
+{
+    if ((arg == NULL) || (*arg == '\0')) {
+        return false;
     }
-    char *endptr = NULL;
-    CLIPAR_FLOAT val = strtof(arg, &endptr);
-    if (*endptr != '\0') {
+    /* The shortest accepted form is "YYYY-MM-DDTHH:MM:SSZ". */
+    CLIPAR_SIZE_T len = strlen(arg);
+    if (len < 20) {
+        return false;
+    }
+
+    CLIPAR_UINT64 date_pairs = 0;
+    CLIPAR_UINT64 time_pairs = 0;
+    if (!swar_digit_pairs(load_le64(arg), 0x00FFFF00FFFFFFFFULL, 0x2D00002D00000000ULL, &date_pairs) ||
+        !swar_digit_pairs(load_le64(arg + 11), 0xFFFF00FFFF00FFFFULL, 0x00003A00003A0000ULL, &time_pairs)) {
+        return false;
+    }
+    if (!IS_DIGIT(arg[8]) || !IS_DIGIT(arg[9])) {
+        return false;
+    }
+    if ((arg[10] != 'T') && (arg[10] != 't') && (arg[10] != ' ')) {
+        return false;
+    }
+
+    CLIPAR_UINT year = (SWAR_LANE(date_pairs, 0) * 100) + SWAR_LANE(date_pairs, 2);
+    CLIPAR_UINT month = SWAR_LANE(date_pairs, 5);
+    CLIPAR_UINT day = ((CLIPAR_UINT)(arg[8] - '0') * 10) + (CLIPAR_UINT)(arg[9] - '0');
+    CLIPAR_UINT hour = SWAR_LANE(time_pairs, 0);
+    CLIPAR_UINT minute = SWAR_LANE(time_pairs, 3);
+    CLIPAR_UINT second = SWAR_LANE(time_pairs, 6);
+    if ((month < 1) || (month > 12) || (day < 1) || ((day > 28) && (day > days_in_month(year, month))) ||
+        (hour > 23) || (minute > 59) || (second > 59)) {
+        return false;
+    }
+
+    /* Optional fraction: keep nine digits of precision, validate the rest. */
+    const CLIPAR_CHAR *p = arg + 19;
+    CLIPAR_INT64 frac_ns = 0;
+    if ((*p == '.') || (*p == ',')) {
+        static const CLIPAR_INT64 frac_scale[10] = {
+            1000000000LL, 100000000LL, 10000000LL, 1000000LL, 100000LL, 10000LL, 1000LL, 100LL, 10LL, 1LL
+        };
+        const CLIPAR_CHAR *digits = ++p;
+        for (; IS_DIGIT(*p) && ((p - digits) < 9); ++p) {
+            frac_ns = (frac_ns * 10) + (*p - '0');
+        }
+        if (p == digits) {
+            return false;
+        }
+        frac_ns *= frac_scale[p - digits];
+        while (IS_DIGIT(*p)) {
+            p++;
+        }
+    }
+
+    /* Zone designator: 'Z' or a +HH:MM / -HH:MM offset, and nothing after it. */
+    CLIPAR_INT64 offset_s = 0;
+    if ((*p == 'Z') || (*p == 'z')) {
+        p++;
+    } else if ((*p == '+') || (*p == '-')) {
+        if (!IS_DIGIT(p[1]) || !IS_DIGIT(p[2]) || (p[3] != ':') ||
+            !IS_DIGIT(p[4]) || !IS_DIGIT(p[5])) {
+            return false;
+        }
+        CLIPAR_INT off_h = ((p[1] - '0') * 10) + (p[2] - '0');
+        CLIPAR_INT off_m = ((p[4] - '0') * 10) + (p[5] - '0');
+        if ((off_h > 23) || (off_m > 59)) {
+            return false;
+        }
+        offset_s = ((CLIPAR_INT64)off_h * 3600) + ((CLIPAR_INT64)off_m * 60);
+        if (*p == '-') {
+            offset_s = -offset_s;
+        }
+        p += 6;
+    } else {
+        return false;
+    }
+    if (*p != '\0') {
+        return false;
+    }
+
+    CLIPAR_INT64 secs = (days_from_civil(year, month, day) * 86400) +
+                        ((CLIPAR_INT64)hour * 3600) + ((CLIPAR_INT64)minute * 60) + (CLIPAR_INT64)second -
+                        offset_s;
+    /* Representable range of int64 nanoseconds: INT64_MIN is -9223372037 s + 145224192 ns
+     * (1677-09-21T00:12:43.145224192Z), INT64_MAX is 9223372036 s + 854775807 ns. */
+    if ((secs < -9223372037LL) || ((secs == -9223372037LL) && (frac_ns < 145224192LL)) ||
+        (secs > 9223372036LL) || ((secs == 9223372036LL) && (frac_ns > 854775807LL))) {
+        return false;
+    }
+    if (epoch_ns != NULL) {
+        /* For negative seconds, borrow one second so the product cannot overflow. */
+        *epoch_ns = (secs < 0) ? (((secs + 1) * 1000000000LL) + (frac_ns - 1000000000LL))
+                               : ((secs * 1000000000LL) + frac_ns);
+    }
+    return true;
+}
+
+/**
+ * @brief Parses a duration such as "250ms", "1h30m" or "1.5s" into nanoseconds and validates its range.
+ *
+ * The duration is one or more "<number>[.<fraction>]<unit>" components whose values are
+ * summed. Units are "ns", "us", "ms", "s", "m", "h" and "d" (case-sensitive). A bare "0"
+ * is also accepted. Number and unit are tokenized in one pass, units are resolved through
+ * a perfect-hash table, and all arithmetic is overflow-checked integer math.
+ *
+ * @param arg The input string.
+ * @param min Minimum allowed value in nanoseconds.
+ * @param max Maximum allowed value in nanoseconds.
+ * @param out Pointer to store the parsed duration in nanoseconds.
+ * @return CLIPAR_BOOL true if successful and within range; false otherwise.
+ */
+CLIPAR_BOOL parse_duration_ns(const CLIPAR_CHAR *arg, CLIPAR_UINT64 min, CLIPAR_UINT64 max, CLIPAR_UINT64 *out)
+{
+    if ((arg == NULL) || (*arg == '\0')) {
+        return false;
+    }
+    CLIPAR_UINT64 total = 0;
+    if ((arg[0] != '0') || (arg[1] != '\0')) {
+        const CLIPAR_CHAR *p = arg;
+        while (*p != '\0') {
+            CLIPAR_UINT64 whole = 0;
+            CLIPAR_UINT64 frac = 0;
+            CLIPAR_UINT64 frac_scale = 1;
+            CLIPAR_CHAR unit[UNIT_MAX_LEN];
+            CLIPAR_SIZE_T unit_len = 0;
+            CLIPAR_UINT64 val = 0;
+            if (!scan_quantity(&p, &whole, &frac, &frac_scale, unit, &unit_len, false) || (unit_len == 0)) {
+                return false;
+            }
+            CLIPAR_UINT64 mult = lookup_unit(duration_units, DURATION_UNIT_FACTOR, DURATION_UNIT_MASK, unit, unit_len);
+            if ((mult == 0) || !scale_quantity(whole, frac, frac_scale, mult, &val) || (val > (UINT64_MAX - total))) {
+                return false;
+            }
+            total += val;
+        }
+    }
+    if ((total < min) || (total > max)) {
+        return false;
+    }
+    if (out != NULL) {
+        *out = total;
+    }
+    return true;
+}
+
+/**
+ * @brief Parses a byte size such as "4096", "64KiB", "1.5MB" or "2G" and validates its range.
+ *
+ * Accepts "<number>[.<fraction>][unit]" with a case-insensitive unit: none or "B" for bytes,
+ * "K", "M", "G", "T", "P", "E" or "KiB" ... "EiB" for powers of 1024, and "KB" ... "EB" for
+ * powers of 1000. Fractional results are truncated to whole bytes. Units are resolved
+ * through a perfect-hash table and all arithmetic is overflow-checked integer math.
+ *
+ * @param arg The input string.
+ * @param min Minimum allowed value in bytes.
+ * @param max Maximum allowed value in bytes.
+ * @param out Pointer to store the parsed size in bytes.
+ * @return CLIPAR_BOOL true if successful and within range; false otherwise.
+ */
+CLIPAR_BOOL parse_size_bytes(const CLIPAR_CHAR *arg, CLIPAR_UINT64 min, CLIPAR_UINT64 max, CLIPAR_UINT64 *out)
+{
+    if ((arg == NULL) || (*arg == '\0')) {
+        return false;
+    }
+    const CLIPAR_CHAR *p = arg;
+    CLIPAR_UINT64 whole = 0;
+    CLIPAR_UINT64 frac = 0;
+    CLIPAR_UINT64 frac_scale = 1;
+    CLIPAR_CHAR unit[UNIT_MAX_LEN];
+    CLIPAR_SIZE_T unit_len = 0;
+    CLIPAR_UINT64 val = 0;
+    if (!scan_quantity(&p, &whole, &frac, &frac_scale, unit, &unit_len, true) || (*p != '\0')) {
+        return false;
+    }
+    CLIPAR_UINT64 mult = 1;
+    if (unit_len != 0) {
+        mult = lookup_unit(size_units, SIZE_UNIT_FACTOR, SIZE_UNIT_MASK, unit, unit_len);
+    }
+    if ((mult == 0) || !scale_quantity(whole, frac, frac_scale, mult, &val)) {
+        return false;
+    }
+    if ((val < min) || (val > max)) {
+        return false;
+    }
+    if (out != NULL) {
+        *out = val;
+    }
+    return true;
+}
+
+/**
+ * @brief Parses a UUID/GUID in "8-4-4-4-12" form into its 16 bytes.
+ *
+ * Accepts "xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx" with upper or lower case hex digits,
+ * optionally enclosed in braces. Bytes are stored in text order (RFC 4122 network order).
+ * When built with SSSE3 the digits are gathered and decoded with one shuffle sequence;
+ * otherwise a table-driven scalar decoder is used.
+ *
+ * @param arg The input string.
+ * @param out Buffer to store the 16 parsed bytes.
+ * @return CLIPAR_BOOL true if valid; false otherwise.
+ */
+CLIPAR_BOOL parse_uuid(const CLIPAR_CHAR *arg, CLIPAR_UINT8 out[16])
+{
+    if ((arg == NULL) || (*arg == '\0')) {
+        return false;
+    }
+    const CLIPAR_CHAR *end = (const CLIPAR_CHAR *)memchr(arg, '\0', UUID_TEXT_LEN + 3);
+    if (end == NULL) {
+        return false;
+    }
+    CLIPAR_SIZE_T len = (CLIPAR_SIZE_T)(end - arg);
+    if ((len == UUID_TEXT_LEN + 2) && (arg[0] == '{') && (arg[UUID_TEXT_LEN + 1] == '}')) {
+        arg++;
+    } else if (len != UUID_TEXT_LEN) {
+        return false;
+    }
+
+    CLIPAR_UINT8 bytes[16];
+#if CLIPAR_USE_SSSE3
+    if (!uuid_decode_ssse3(arg, bytes)) {
+        return false;
+    }
+#else
+    if (!uuid_decode_scalar(arg, bytes)) {
+        return false;
+    }
+#endif
+    if (out != NULL) {
+        memcpy(out, bytes, sizeof(bytes));
+    }
+    return true;
+}
+
+/**
+ * @brief Parses an array of UUID/GUID strings, stopping at the first invalid one.
+ *
+ * @param args Array of input strings.
+ * @param count Number of elements in args and out.
+ * @param out Array to store the parsed 16-byte values.
+ * @return CLIPAR_SIZE_T Number of leading entries parsed successfully (count if all are valid).
+ */
+CLIPAR_SIZE_T parse_uuid_batch(const CLIPAR_CHAR *args[], CLIPAR_SIZE_T count, CLIPAR_UINT8 out[][16])
+{
+    if ((args == NULL) || (out == NULL)) {
+        return 0;
+    }
+    for (CLIPAR_SIZE_T i = 0; i < count; i++) {
+        if (!parse_uuid(args[i], out[i])) {
+            return i;
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief Initializes a streaming base64 decoder.
+ *
+ * @param st The decoder state to initialize.
+ * @param url_safe true for the URL-safe alphabet ("-_"), false for the standard one ("+/").
+ */
+void parse_base64_init(base64_stream_t *st, CLIPAR_BOOL url_safe)
+{
+    if (st == NULL) {
+        return;
+    }
+    st->quad = 0;
+    st->pending = 0;
+    st->padding = 0;
+    st->url_safe = url_safe;
+}
+
+/**
+ * @brief Decodes the next chunk of a base64 stream into a bounded output buffer.
+ *
+ * Decoding stops early, without error, when the output buffer cannot take the next group;
+ * *consumed then tells the caller where to resume with a fresh buffer. Padding is optional,
+ * but once a '=' is seen only the remaining padding of that group may follow.
+ *
+ * @param st The decoder state.
+ * @param in Input characters (need not be NUL-terminated).
+ * @param len Number of input characters.
+ * @param consumed Pointer to store the number of input characters consumed.
+ * @param out Output buffer.
+ * @param cap Size of the output buffer in bytes (at least 3 to guarantee progress).
+ * @param out_len Pointer to store the number of bytes written.
+ * @return CLIPAR_BOOL true if the consumed input is valid base64; false otherwise.
+ */
+CLIPAR_BOOL parse_base64_update(base64_stream_t *st, const CLIPAR_CHAR *in, CLIPAR_SIZE_T len, CLIPAR_SIZE_T *consumed,
+                                CLIPAR_UINT8 *out, CLIPAR_SIZE_T cap, CLIPAR_SIZE_T *out_len)
+{
+    if ((st == NULL) || ((in == NULL) && (len != 0)) || ((out == NULL) && (cap != 0))) {
+        return false;
+    }
+    const unsigned char *table = st->url_safe ? base64_url_value : base64_std_value;
+    CLIPAR_SIZE_T i = 0;
+    CLIPAR_SIZE_T w = 0;
+    CLIPAR_BOOL ok = true;
+
+    while (i < len) {
+        if ((st->pending == 0) && (st->padding == 0)) {
+            CLIPAR_SIZE_T nquads = (len - i) / 4;
+            if (nquads > ((cap - w) / 3)) {
+                nquads = (cap - w) / 3;
+            }
+            CLIPAR_SIZE_T done = base64_decode_quads(in + i, nquads, out + w, cap - w, st->url_safe);
+            i += 4 * done;
+            w += 3 * done;
+            if (i == len) {
+                break;
+            }
+        }
+
+        /* Slow path: one character at a time through the group buffer. */
+        unsigned char c = (unsigned char)in[i];
+        if (c == '=') {
+            if ((st->pending < 2) || ((st->pending + st->padding) >= 4)) {
+                ok = false;
+                break;
+            }
+            if ((st->pending + st->padding + 1) == 4) {
+                if ((cap - w) < (st->pending - 1)) {
+                    break;
+                }
+                CLIPAR_SIZE_T n = base64_emit_tail(st, out + w);
+                if (n == 0) {
+                    ok = false;
+                    break;
+                }
+                w += n;
+                st->pending = 0;
+            }
+            st->padding++;
+            i++;
+            continue;
+        }
+        unsigned int v = table[c];
+        if ((st->padding != 0) || ((v & 0x80u) != 0)) {
+            ok = false;
+            break;
+        }
+        if (st->pending == 3) {
+            if ((cap - w) < 3) {
+                break;
+            }
+            CLIPAR_UINT32 q = (st->quad << 6) | v;
+            out[w] = (CLIPAR_UINT8)(q >> 16);
+            out[w + 1] = (CLIPAR_UINT8)(q >> 8);
+            out[w + 2] = (CLIPAR_UINT8)q;
+            w += 3;
+            st->quad = 0;
+            st->pending = 0;
+        } else {
+            st->quad = (st->quad << 6) | v;
+            st->pending++;
+        }
+        i++;
+    }
+
+    if (consumed != NULL) {
+        *consumed = i;
+    }
+    if (out_len != NULL) {
+        *out_len = w;
+    }
+    return ok;
+}
+
+/**
+ * @brief Finishes a base64 stream, flushing an unpadded final group.
+ *
+ * @param st The decoder state.
+ * @param out Output buffer for the last 0 to 2 bytes.
+ * @param cap Size of the output buffer in bytes.
+ * @param out_len Pointer to store the number of bytes written.
+ * @return CLIPAR_BOOL true if the stream ended on a complete encoding; false otherwise.
+ */
+CLIPAR_BOOL parse_base64_final(base64_stream_t *st, CLIPAR_UINT8 *out, CLIPAR_SIZE_T cap, CLIPAR_SIZE_T *out_len)
+{
+    if (st == NULL) {
+        return false;
+    }
+    CLIPAR_SIZE_T n = 0;
+    if (st->pending != 0) {
+        if ((st->padding != 0) || (st->pending < 2) || (out == NULL) || (cap < (st->pending - 1))) {
+            return false;
+        }
+        n = base64_emit_tail(st, out);
+        if (n == 0) {
+            return false;
+        }
+        st->pending = 0;
+    }
+    if (out_len != NULL) {
+        *out_len = n;
+    }
+    return true;
+}
+
+/**
+ * @brief Decodes a complete base64 argument into a buffer.
+ *
+ * @param arg The input characters.
+ * @param len Number of input characters.
+ * @param out Output buffer.
+ * @param cap Size of the output buffer in bytes.
+ * @param out_len Pointer to store the number of decoded bytes.
+ * @param url_safe Whether to use the URL-safe alphabet.
+ * @return CLIPAR_BOOL true if the input is valid and fits in the buffer; false otherwise.
+ */
+static CLIPAR_BOOL decode_base64_arg(const CLIPAR_CHAR *arg, CLIPAR_SIZE_T len, CLIPAR_UINT8 *out, CLIPAR_SIZE_T cap,
+                                     CLIPAR_SIZE_T *out_len, CLIPAR_BOOL url_safe)
+{
+    if ((arg == NULL) || (len == 0)) {
+        return false;
+    }
+    base64_stream_t st;
+    CLIPAR_SIZE_T consumed = 0;
+    CLIPAR_SIZE_T body = 0;
+    CLIPAR_SIZE_T tail = 0;
+    parse_base64_init(&st, url_safe);
+    if (!parse_base64_update(&st, arg, len, &consumed, out, cap, &body) || (consumed != len) ||
+        !parse_base64_final(&st, out + body, cap - body, &tail)) {
+        return false;
+    }
+    if (out_len != NULL) {
+        *out_len = body + tail;
+    }
+    return true;
+}
+
+/**
+ * @brief Decodes a standard-alphabet ("+/") base64 argument such as a key or certificate.
+ *
+ * Validation and decoding happen in one pass, 16 characters at a time when SSSE3 is
+ * available. Padding is optional; non-canonical trailing bits are rejected.
+ *
+ * @param arg The input characters (need not be NUL-terminated).
+ * @param len Number of input characters.
+ * @param out Output buffer.
+ * @param cap Size of the output buffer in bytes.
+ * @param out_len Pointer to store the number of decoded bytes.
+ * @return CLIPAR_BOOL true if the input is valid and fits in the buffer; false otherwise.
+ */
+CLIPAR_BOOL parse_base64(const CLIPAR_CHAR *arg, CLIPAR_SIZE_T len, CLIPAR_UINT8 *out, CLIPAR_SIZE_T cap, CLIPAR_SIZE_T *out_len)
+{
+    return decode_base64_arg(arg, len, out, cap, out_len, false);
+}
+
+/**
+ * @brief Decodes a URL-safe ("-_") base64 argument.
+ *
+ * Behaves like parse_base64() with the RFC 4648 section 5 alphabet.
+ *
+ * @param arg The input characters (need not be NUL-terminated).
+ * @param len Number of input characters.
+ * @param out Output buffer.
+ * @param cap Size of the output buffer in bytes.
+ * @param out_len Pointer to store the number of decoded bytes.
+ * @return CLIPAR_BOOL true if the input is valid and fits in the buffer; false otherwise.
+ */
+CLIPAR_BOOL parse_base64url(const CLIPAR_CHAR *arg, CLIPAR_SIZE_T len, CLIPAR_UINT8 *out, CLIPAR_SIZE_T cap, CLIPAR_SIZE_T *out_len)
+{
+    return decode_base64_arg(arg, len, out, cap, out_len, true);
+}
+
+/**
+ * @brief Compiles an allow-set specification such as "1-1005,1025-4094" or "1500,9000".
+ *
+ * The specification is a comma-separated list of single values and "lo-hi" ranges in
+ * decimal or "0x" hexadecimal; signed sets also accept negative values ("-10--1,5").
+ * Overlapping and adjacent entries are merged into sorted intervals before the
+ * CLIPAR_INTERVAL_SET_MAX limit is applied, so it bounds the merged intervals rather than
+ * the listed entries, and membership can be tested with a binary search.
+ *
+ * @param spec The set specification.
+ * @param is_signed Whether the set holds signed values (for parse_int_in_set).
+ * @param set Pointer to the set to fill.
+ * @return CLIPAR_BOOL true if the specification is valid and fits; false otherwise.
+ */
+CLIPAR_BOOL interval_set_compile(const CLIPAR_CHAR *spec, CLIPAR_BOOL is_signed, interval_set_t *set)
+{
+    if ((spec == NULL) || (*spec == '\0') || (set == NULL)) {
+        return false;
+    }
+    set->count = 0;
+    set->is_signed = is_signed;
+
+    const CLIPAR_CHAR *p = spec;
+    CLIPAR_BOOL overflow = false;
+    while (*p != '\0') {
+        CLIPAR_UINT64 lo = 0;
+        CLIPAR_UINT64 hi = 0;
+        if (!scan_interval_entry(&p, is_signed, &lo, &hi)) {
+            return false;
+        }
+        if (!overflow && !interval_set_insert(set, lo, hi)) {
+            overflow = true;
+        }
+    }
+    /* The limit applies to merged intervals, so a full set is only final once every entry is in. */
+    return (!overflow || interval_set_sweep(spec, set));
+}
+
+/**
+ * @brief Parses an unsigned 32-bit integer and validates it against an interval set.
+ *
+ * Digits are converted and overflow-checked in one pass, followed by a single set lookup.
+ *
+ * @param arg The input string.
+ * @param set Compiled unsigned interval set of allowed values.
+ * @param out Pointer to store the parsed value.
+ * @return CLIPAR_BOOL true if successful and in the set; false otherwise.
+ */
+CLIPAR_BOOL parse_uint32_in_set(const CLIPAR_CHAR *arg, const interval_set_t *set, CLIPAR_UINT32 *out)
+{
+    CLIPAR_UINT64 key = 0;
+    if ((set == NULL) || set->is_signed || !parse_key_in_set(arg, set, 10, &key) || (key > UINT32_MAX)) {
+        return false;
+    }
+    if (out != NULL) {
+        *out = (CLIPAR_UINT32)key;
+    }
+    return true;
+}
+
+/**
+ * @brief Parses an unsigned 64-bit integer and validates it against an interval set.
+ *
+ * @param arg The input string.
+ * @param set Compiled unsigned interval set of allowed values.
+ * @param out Pointer to store the parsed value.
+ * @return CLIPAR_BOOL true if successful and in the set; false otherwise.
+ */
+CLIPAR_BOOL parse_uint64_in_set(const CLIPAR_CHAR *arg, const interval_set_t *set, CLIPAR_UINT64 *out)
+{
+    CLIPAR_UINT64 key = 0;
+    if ((set == NULL) || set->is_signed || !parse_key_in_set(arg, set, 10, &key)) {
+        return false;
+    }
+    if (out != NULL) {
+        *out = (CLIPAR_UINT64)key;
+    }
+    return true;
+}
+
+/**
+ * @brief Parses a signed integer and validates it against an interval set.
+ *
+ * @param arg The input string.
+ * @param set Compiled signed interval set of allowed values.
+ * @param out Pointer to store the parsed value.
+ * @return CLIPAR_BOOL true if successful, in the set and representable as CLIPAR_INT; false otherwise.
+ */
+CLIPAR_BOOL parse_int_in_set(const CLIPAR_CHAR *arg, const interval_set_t *set, CLIPAR_INT *out)
+{
+    CLIPAR_UINT64 key = 0;
+    if ((set == NULL) || !set->is_signed || !parse_key_in_set(arg, set, 10, &key)) {
+        return false;
+    }
+    CLIPAR_INT64 val = interval_key_to_int64(key);
+    if ((CLIPAR_INT64)(CLIPAR_INT)val != val) {
+        return false;
+    }
+    if (out != NULL) {
+        *out = (CLIPAR_INT)val;
+    }
+    return true;
+}
+
+/**
+ * @brief Parses a hexadecimal number (optional "0x"/"0X" prefix) and validates it against an interval set.
+ *
+ * @param arg The input string.
+ * @param set Compiled unsigned interval set of allowed values.
+ * @param out Pointer to store the parsed value.
+ * @return CLIPAR_BOOL true if successful, in the set and representable as CLIPAR_ULONG; false otherwise.
+ */
+CLIPAR_BOOL parse_hex_in_set(const CLIPAR_CHAR *arg, const interval_set_t *set, CLIPAR_ULONG *out)
+{
+    CLIPAR_UINT64 key = 0;
+    if ((set == NULL) || set->is_signed || !parse_key_in_set(arg, set, 16, &key) ||
+        ((CLIPAR_UINT64)(CLIPAR_ULONG)key != key)) {
         return false;
     }
-    if ((val < min) || (val > max)) {
+    if (out != NULL) {
+        *out = (CLIPAR_ULONG)key;
+    }
+    return true;
+}
+
+/**
+ * @brief Parses a TCP/UDP port given as a number or as a well-known service name.
+ *
+ * Numbers ("22", "8080") are converted in a single pass and must be in 0-65535. Names
+ * ("ssh", "https", "bgp"; case-insensitive) are resolved through a perfect-hash table of
+ * IANA service names compiled into the library, so no file I/O, NSS lookups or locks are
+ * involved, unlike getservbyname().
+ *
+ * @param arg The input string.
+ * @param out Pointer to store the port number.
+ * @return CLIPAR_BOOL true if the argument is a valid port number or known service name; false otherwise.
+ */
+CLIPAR_BOOL parse_port(const CLIPAR_CHAR *arg, CLIPAR_UINT32 *out)
+{
+    if ((arg == NULL) || (*arg == '\0')) {
         return false;
     }
+    CLIPAR_UINT32 port = 0;
+    if (IS_DIGIT(*arg)) {
+        const CLIPAR_CHAR *end = NULL;
+        CLIPAR_UINT64 val = 0;
+        if (!scan_uint64(arg, 10, &end, &val) || (*end != '\0') || (val > 65535u)) {
+            return false;
+        }
+        port = (CLIPAR_UINT32)val;
+    } else {
+        CLIPAR_CHAR name[SERVICE_NAME_MAX];
+        CLIPAR_SIZE_T len = 0;
+        for (; arg[len] != '\0'; len++) {
+            if (len == (SERVICE_NAME_MAX - 1)) {
+                return false;
+            }
+            CLIPAR_CHAR c = arg[len];
+            if ((c >= 'A') && (c <= 'Z')) {
+                c = c + ('a' - 'A');
+            }
+            name[len] = c;
+        }
+        name[len] = '\0';
+        CLIPAR_UINT32 seed = service_disp[fnv1a32(name, len, 0) & (SERVICE_BUCKETS - 1)];
+        const service_entry_t *e = &service_table[fnv1a32(name, len, seed) & (SERVICE_SLOTS - 1)];
+        if (strcmp(e->name, name) != 0) {
+            return false;
+        }
+        port = e->port;
+    }
     if (out != NULL) {
-        *out = val;
+        *out = port;
     }
     return true;
 }
 
 /**
- * @brief Parses a hexadecimal number from a string and validates its range.
+ * @brief Parses an unsigned 128-bit integer from a string and validates its range.
  *
- * Accepts an optional "0x" or "0X" prefix.
+ * Accepts decimal digits, or hexadecimal digits with a "0x"/"0X" prefix.
  *
  * @param arg The input string.
  * @param min Minimum allowed value.
  * @param max Maximum allowed value.
- * @param out Pointer to store the parsed hexadecimal value.
+ * @param out Pointer to store the parsed value.
  * @return CLIPAR_BOOL true if successful and within range; false otherwise.
  */
-CLIPAR_BOOL parse_hex_in_range(const CLIPAR_CHAR *arg, CLIPAR_ULONG min, CLIPAR_ULONG max, CLIPAR_ULONG *out)
+CLIPAR_BOOL parse_uint128_in_range(const CLIPAR_CHAR *arg, uint128_value_t min, uint128_value_t max, uint128_value_t *out)
 {
     if ((arg == NULL) || (*arg == '\0')) {
         return false;
     }
-    if ((arg[0] == '0') && ((arg[1] == 'x') || (arg[1] == 'X'))) {
-        arg += 2;
+    uint128_value_t val;
+    if (!scan_uint128(arg, &val)) {
+        return false;
     }
-    if (!is_hex_digits(arg)) {
+    if (uint128_less(val, min) || uint128_less(max, val)) {
         return false;
     }
-    char *endptr = NULL;
-    CLIPAR_ULONG val = strtoul(arg, &endptr, 16);
-    if (*endptr != '\0') {
+    if (out != NULL) {
+        *out = val;
+    }
+    return true;
+}
+
+/**
+ * @brief Formats an unsigned 128-bit integer as decimal or "0x"-prefixed lower-case hexadecimal.
+ *
+ * Decimal output divides the value by 10^9 across four 32-bit limbs and writes each group
+ * two digits at a time, so no 128-bit division is needed.
+ *
+ * @param value The value to format.
+ * @param hex Whether to format in hexadecimal.
+ * @param buf Output buffer; always NUL-terminated on success.
+ * @param size Size of the output buffer (CLIPAR_UINT128_STRLEN is always enough).
+ * @return CLIPAR_SIZE_T Number of characters written, excluding the NUL; 0 if the buffer is too small.
+ */
+CLIPAR_SIZE_T format_uint128(uint128_value_t value, CLIPAR_BOOL hex, CLIPAR_CHAR *buf, CLIPAR_SIZE_T size)
+{
+    CLIPAR_CHAR tmp[CLIPAR_UINT128_STRLEN];
+    CLIPAR_CHAR *end = tmp + sizeof(tmp) - 1;
+    CLIPAR_CHAR *p = end;
+
+    if (buf == NULL) {
+        return 0;
+    }
+    *end = '\0';
+    if (hex) {
+        static const CLIPAR_CHAR xdigits[] = "0123456789abcdef";
+        do {
+            *--p = xdigits[value.lo & 0x0Fu];
+            value.lo = (value.lo >> 4) | (value.hi << 60);
+            value.hi >>= 4;
+        } while ((value.lo | value.hi) != 0);
+        *--p = 'x';
+        *--p = '0';
+    } else {
+        CLIPAR_UINT32 limbs[4] = {
+            (CLIPAR_UINT32)(value.hi >> 32), (CLIPAR_UINT32)value.hi,
+            (CLIPAR_UINT32)(value.lo >> 32), (CLIPAR_UINT32)value.lo
+        };
+        for (;;) {
+            CLIPAR_UINT64 rem = 0;
+            CLIPAR_BOOL more = false;
+            for (CLIPAR_SIZE_T i = 0; i < 4; i++) {
+                CLIPAR_UINT64 cur = (rem << 32) | limbs[i];
+                limbs[i] = (CLIPAR_UINT32)(cur / 1000000000u);
+                rem = cur % 1000000000u;
+                more = more || (limbs[i] != 0);
+            }
+            p = write_digits_backward(p, (CLIPAR_UINT32)rem, more ? 9 : 1);
+            if (!more) {
+                break;
+            }
+        }
+    }
+
+    CLIPAR_SIZE_T len = (CLIPAR_SIZE_T)(end - p);
+    if (size <= len) {
+        return 0;
+    }
+    memcpy(buf, p, len + 1);
+    return len;
+}
+
+/**
+ * @brief Formats an unsigned 32-bit integer in decimal.
+ *
+ * Digits are produced two at a time from a pair table, without snprintf() or allocation,
+ * so a caller can render many values into one large buffer by advancing buf by the
+ * returned length.
+ *
+ * @param value The value to format.
+ * @param buf Output buffer; always NUL-terminated on success.
+ * @param size Size of the output buffer (CLIPAR_UINT64_STRLEN is always enough).
+ * @return CLIPAR_SIZE_T Number of characters written, excluding the NUL; 0 if the buffer is too small.
+ */
+CLIPAR_SIZE_T format_uint32(CLIPAR_UINT32 value, CLIPAR_CHAR *buf, CLIPAR_SIZE_T size)
+{
+    CLIPAR_CHAR tmp[CLIPAR_UINT64_STRLEN];
+    CLIPAR_CHAR *end = tmp + sizeof(tmp);
+    CLIPAR_CHAR *p = write_digits_backward(end, value, 1);
+    return emit_formatted(p, (CLIPAR_SIZE_T)(end - p), buf, size);
+}
+
+/**
+ * @brief Formats an unsigned 64-bit integer in decimal.
+ *
+ * Values above 32 bits are split into groups of nine digits so that each group is
+ * formatted with 32-bit arithmetic.
+ *
+ * @param value The value to format.
+ * @param buf Output buffer; always NUL-terminated on success.
+ * @param size Size of the output buffer (CLIPAR_UINT64_STRLEN is always enough).
+ * @return CLIPAR_SIZE_T Number of characters written, excluding the NUL; 0 if the buffer is too small.
+ */
+CLIPAR_SIZE_T format_uint64(CLIPAR_UINT64 value, CLIPAR_CHAR *buf, CLIPAR_SIZE_T size)
+{
+    CLIPAR_CHAR tmp[CLIPAR_UINT64_STRLEN];
+    CLIPAR_CHAR *end = tmp + sizeof(tmp);
+    CLIPAR_CHAR *p = write_uint64_backward(end, value);
+    return emit_formatted(p, (CLIPAR_SIZE_T)(end - p), buf, size);
+}
+
+/**
+ * @brief Formats a signed integer in decimal, with a leading '-' for negative values.
+ *
+ * @param value The value to format.
+ * @param buf Output buffer; always NUL-terminated on success.
+ * @param size Size of the output buffer (CLIPAR_UINT64_STRLEN is always enough for a 64-bit CLIPAR_INT).
+ * @return CLIPAR_SIZE_T Number of characters written, excluding the NUL; 0 if the buffer is too small.
+ */
+CLIPAR_SIZE_T format_int(CLIPAR_INT value, CLIPAR_CHAR *buf, CLIPAR_SIZE_T size)
+{
+    CLIPAR_CHAR tmp[CLIPAR_UINT64_STRLEN];
+    CLIPAR_CHAR *end = tmp + sizeof(tmp);
+    CLIPAR_UINT64 mag = (value < 0) ? (0 - (CLIPAR_UINT64)value) : (CLIPAR_UINT64)value;
+    CLIPAR_CHAR *p = write_uint64_backward(end, mag);
+    if (value < 0) {
+        *--p = '-';
+    }
+    return emit_formatted(p, (CLIPAR_SIZE_T)(end - p), buf, size);
+}
+
+/**
+ * @brief Formats an IPv4 address in dotted-decimal notation.
+ *
+ * @param addr The address in host byte order, first octet in the most significant byte, as
+ *             returned by parse_ip_address_value().
+ * @param buf Output buffer; always NUL-terminated on success.
+ * @param size Size of the output buffer (CLIPAR_IPV4_STRLEN is always enough).
+ * @return CLIPAR_SIZE_T Number of characters written, excluding the NUL; 0 if the buffer is too small.
+ */
+CLIPAR_SIZE_T format_ip_address(CLIPAR_UINT32 addr, CLIPAR_CHAR *buf, CLIPAR_SIZE_T size)
+{
+    CLIPAR_CHAR tmp[CLIPAR_IPV4_STRLEN];
+    CLIPAR_CHAR *end = tmp + sizeof(tmp);
+    CLIPAR_CHAR *p = write_ipv4_backward(end, addr);
+    return emit_formatted(p, (CLIPAR_SIZE_T)(end - p), buf, size);
+}
+
+/**
+ * @brief Formats an IPv4 address with prefix length as "A.B.C.D/Y".
+ *
+ * @param addr The address in host byte order, first octet in the most significant byte, as
+ *             returned by parse_ip_address_with_netmask_value().
+ * @param prefix_len The prefix length (0-32).
+ * @param buf Output buffer; always NUL-terminated on success.
+ * @param size Size of the output buffer (CLIPAR_IPV4_STRLEN is always enough).
+ * @return CLIPAR_SIZE_T Number of characters written, excluding the NUL; 0 if the buffer is too
+ *         small or prefix_len is greater than 32.
+ */
+CLIPAR_SIZE_T format_ip_address_with_netmask(CLIPAR_UINT32 addr, CLIPAR_UINT prefix_len, CLIPAR_CHAR *buf, CLIPAR_SIZE_T size)
+{
+    if (prefix_len > 32) {
+        return 0;
+    }
+    CLIPAR_CHAR tmp[CLIPAR_IPV4_STRLEN];
+    CLIPAR_CHAR *end = tmp + sizeof(tmp);
+    CLIPAR_CHAR *p = write_digits_backward(end, (CLIPAR_UINT32)prefix_len, 1);
+    *--p = '/';
+    p = write_ipv4_backward(p, addr);
+    return emit_formatted(p, (CLIPAR_SIZE_T)(end - p), buf, size);
+}
+
+/**
+ * @brief Compiles a glob pattern argument such as "eth*" or "Gi0/[1-4]" into a matcher.
+ *
+ * Supports '*', '?', bracket classes ("[a-z]", "[!0-9]", "[^x]") and '\' escapes with
+ * fnmatch() semantics (no special handling of '/' or leading '.'). The pattern is split at
+ * '*' into segments of literal bytes, '?' and classes; classes become 256-bit sets. The
+ * compiled form uses fixed-size storage and can be matched any number of times with
+ * glob_match() without re-reading the pattern.
+ *
+ * @param arg The pattern string (shorter than CLIPAR_GLOB_MAX_PATTERN).
+ * @param out Pointer to store the compiled pattern.
+ * @return CLIPAR_BOOL true if the pattern is valid and fits; false otherwise.
+ */
+CLIPAR_BOOL parse_glob(const CLIPAR_CHAR *arg, glob_pattern_t *out)
+{
+    if ((arg == NULL) || (*arg == '\0') || (out == NULL)) {
         return false;
     }
-    if ((val < min) || (val > max)) {
+    CLIPAR_SIZE_T src_len = 0;
+    CLIPAR_UINT64 hash = fnv1a64(arg, &src_len);
+    if (src_len >= CLIPAR_GLOB_MAX_PATTERN) {
         return false;
     }
-    if (out != NULL) {
-        *out = val;
+    memset(out, 0, sizeof(*out));
+    memcpy(out->source, arg, src_len + 1);
+    out->source_hash = hash;
+
+    CLIPAR_SIZE_T elems = 0;
+    CLIPAR_SIZE_T seg = 0;
+    CLIPAR_BOOL in_literal_run = true;
+    const unsigned char *p = (const unsigned char *)arg;
+    while (*p != '\0') {
+        if (*p == '*') {
+            while (*p == '*') {
+                p++;
+            }
+            if (++seg == CLIPAR_GLOB_MAX_SEGMENTS) {
+                return false;
+            }
+            out->seg_start[seg] = (CLIPAR_UINT8)elems;
+            in_literal_run = true;
+            continue;
+        }
+        CLIPAR_UINT8 kind = GLOB_ELEM_LITERAL;
+        CLIPAR_UINT8 value = 0;
+        if (*p == '?') {
+            kind = GLOB_ELEM_ANY;
+            p++;
+        } else if (*p == '[') {
+            if (out->num_classes == CLIPAR_GLOB_MAX_CLASSES) {
+                return false;
+            }
+            CLIPAR_UINT8 *bits = out->classes[out->num_classes];
+            const unsigned char *q = p + 1;
+            CLIPAR_BOOL negate = false;
+            if ((*q == '!') || (*q == '^')) {
+                negate = true;
+                q++;
+            }
+            /* A ']' right after the opening bracket is a member, not the terminator. */
+            CLIPAR_BOOL first = true;
+            while ((*q != '\0') && ((*q != ']') || first)) {
+                unsigned char lo = *q;
+                unsigned char hi = *q;
+                if ((lo == '\\') && (q[1] != '\0')) {
+                    lo = hi = *++q;
+                }
+                if ((q[1] == '-') && (q[2] != ']') && (q[2] != '\0')) {
+                    hi = q[2];
+                    if ((hi == '\\') && (q[3] != '\0')) {
+                        hi = q[3];
+                        q++;
+                    }
+                    q += 2;
+                }
+                for (unsigned int c = lo; c <= hi; c++) {
+                    bits[c >> 3] |= (CLIPAR_UINT8)(1u << (c & 7u));
+                }
+                q++;
+                first = false;
+            }
+            if (*q != ']') {
+                return false;
+            }
+            if (negate) {
+                for (CLIPAR_SIZE_T i = 0; i < 32; i++) {
+                    bits[i] = (CLIPAR_UINT8)~bits[i];
+                }
+            }
+            kind = GLOB_ELEM_CLASS;
+            value = (CLIPAR_UINT8)out->num_classes++;
+            p = q + 1;
+        } else {
+            if (*p == '\\') {
+                if (p[1] == '\0') {
+                    return false;
+                }
+                p++;
+            }
+            value = *p++;
+        }
+        if (elems == CLIPAR_GLOB_MAX_PATTERN) {
+            return false;
+        }
+        out->elem_kind[elems] = kind;
+        out->elem_arg[elems] = value;
+        out->literals[elems] = (CLIPAR_CHAR)value;
+        if (in_literal_run && (kind == GLOB_ELEM_LITERAL)) {
+            out->seg_literal_len[seg]++;
+        } else {
+            in_literal_run = false;
+        }
+        out->seg_len[seg]++;
+        elems++;
+    }
+    out->num_segments = (CLIPAR_UINT8)(seg + 1);
+    return true;
+}
+
+/**
+ * @brief Matches a name against a compiled glob pattern.
+ *
+ * The first segment is anchored at the start of the name (a pure literal prefix is a single
+ * memcmp) and the last at the end; the segments in between are located leftmost-first,
+ * which is exact for glob patterns and needs no backtracking.
+ *
+ * @param pattern The compiled pattern from parse_glob().
+ * @param name The name to test.
+ * @return CLIPAR_BOOL true if the whole name matches; false otherwise.
+ */
+CLIPAR_BOOL glob_match(const glob_pattern_t *pattern, const CLIPAR_CHAR *name)
+{
+    if ((pattern == NULL) || (name == NULL) || (pattern->num_segments == 0)) {
+        return false;
+    }
+    const CLIPAR_SIZE_T len = strlen(name);
+    const CLIPAR_SIZE_T last = (CLIPAR_SIZE_T)pattern->num_segments - 1;
+    const CLIPAR_SIZE_T head = pattern->seg_len[0];
+
+    if (last == 0) {
+        return ((len == head) && glob_segment_matches(pattern, 0, name));
+    }
+    const CLIPAR_SIZE_T tail = pattern->seg_len[last];
+    if ((len < (head + tail)) || !glob_segment_matches(pattern, 0, name) ||
+        !glob_segment_matches(pattern, last, name + (len - tail))) {
+        return false;
+    }
+    const CLIPAR_CHAR *p = name + head;
+    const CLIPAR_CHAR *end = name + (len - tail);
+    for (CLIPAR_SIZE_T seg = 1; seg < last; seg++) {
+        const CLIPAR_CHAR *hit = glob_segment_find(pattern, seg, p, (CLIPAR_SIZE_T)(end - p));
+        if (hit == NULL) {
+            return false;
+        }
+        p = hit + pattern->seg_len[seg];
+    }
+    return true;
+}
+
+/**
+ * @brief Initializes an empty glob pattern cache.
+ *
+ * @param cache The cache to initialize.
+ */
+void glob_cache_init(glob_cache_t *cache)
+{
+    if (cache == NULL) {
+        return;
+    }
+    cache->used = 0;
+    cache->clock = 0;
+}
+
+/**
+ * @brief Compiles a glob pattern argument, reusing a cached compilation of the same text.
+ *
+ * The cache holds CLIPAR_GLOB_CACHE_SIZE patterns keyed by their source text; on a miss the
+ * least recently used entry is replaced. Invalid patterns are not cached. The returned
+ * pointer stays valid until the entry is evicted.
+ *
+ * @param cache The cache (typically one per session).
+ * @param arg The pattern string.
+ * @param out Pointer to store the compiled pattern.
+ * @return CLIPAR_BOOL true if the pattern is valid; false otherwise.
+ */
+CLIPAR_BOOL parse_glob_cached(glob_cache_t *cache, const CLIPAR_CHAR *arg, const glob_pattern_t **out)
+{
+    if ((cache == NULL) || (arg == NULL) || (out == NULL)) {
+        return false;
+    }
+    CLIPAR_SIZE_T len = 0;
+    CLIPAR_UINT64 hash = fnv1a64(arg, &len);
+    CLIPAR_SIZE_T victim = 0;
+    for (CLIPAR_SIZE_T i = 0; i < cache->used; i++) {
+        if ((cache->entries[i].source_hash == hash) && (strcmp(cache->entries[i].source, arg) == 0)) {
+            cache->stamps[i] = ++cache->clock;
+            *out = &cache->entries[i];
+            return true;
+        }
+        if (cache->stamps[i] < cache->stamps[victim]) {
+            victim = i;
+        }
+    }
+    if (cache->used < CLIPAR_GLOB_CACHE_SIZE) {
+        victim = cache->used;
+    }
+    glob_pattern_t compiled;
+    if (!parse_glob(arg, &compiled)) {
+        return false;
+    }
+    cache->entries[victim] = compiled;
+    if (victim == cache->used) {
+        cache->used++;
+    }
+    cache->stamps[victim] = ++cache->clock;
+    *out = &cache->entries[victim];
+    return true;
+}
+
+/**
+ * @brief Parses an argument with one bracketed range group, such as "eth[0-47]" or "sw[01-04,10]".
+ *
+ * The text before and after the brackets is kept as prefix and suffix, and the bracket
+ * contents (decimal values and "lo-hi" ranges, comma-separated) are compiled into an
+ * interval set, so the expanded values are produced in ascending order without duplicates.
+ * If any bound is written with a leading zero, every value is zero-padded to the longest
+ * bound, as in "sw01".."sw10". The whole group is parsed once, and the values can then be
+ * handed to a handler in batches with range_expansion_next() instead of re-parsing each
+ * expanded argument.
+ *
+ * @param arg The input string.
+ * @param out Pointer to store the parsed expansion.
+ * @return CLIPAR_BOOL true if arg contains exactly one valid bracket group; false otherwise.
+ */
+CLIPAR_BOOL parse_range_expansion(const CLIPAR_CHAR *arg, range_expansion_t *out)
+{
+    if ((arg == NULL) || (out == NULL)) {
+        return false;
+    }
+    const CLIPAR_CHAR *open = strchr(arg, '[');
+    const CLIPAR_CHAR *close = (open != NULL) ? strchr(open, ']') : NULL;
+    if ((close == NULL) || (strchr(close, '[') != NULL) || (strchr(close + 1, ']') != NULL) ||
+        (memchr(arg, ']', (CLIPAR_SIZE_T)(open - arg)) != NULL)) {
+        return false;
+    }
+    const CLIPAR_SIZE_T prefix_len = (CLIPAR_SIZE_T)(open - arg);
+    const CLIPAR_SIZE_T spec_len = (CLIPAR_SIZE_T)(close - open) - 1;
+    const CLIPAR_SIZE_T suffix_len = strlen(close + 1);
+    CLIPAR_CHAR spec[CLIPAR_RANGE_SPEC_MAX];
+    if ((prefix_len >= CLIPAR_RANGE_AFFIX_MAX) || (suffix_len >= CLIPAR_RANGE_AFFIX_MAX) ||
+        (spec_len == 0) || (spec_len >= sizeof(spec))) {
+        return false;
+    }
+
+    /* Only decimal bounds; also find the zero-padding width while scanning. */
+    CLIPAR_UINT width = 0;
+    CLIPAR_UINT longest = 0;
+    CLIPAR_UINT run = 0;
+    CLIPAR_BOOL padded = false;
+    for (CLIPAR_SIZE_T i = 0; i <= spec_len; i++) {
+        const CLIPAR_CHAR c = (i < spec_len) ? open[1 + i] : ',';
+        if (IS_DIGIT(c)) {
+            if ((run == 0) && (c == '0') && (i + 1 < spec_len) && IS_DIGIT(open[2 + i])) {
+                padded = true;
+            }
+            run++;
+        } else if ((c == ',') || (c == '-')) {
+            longest = (run > longest) ? run : longest;
+            run = 0;
+        } else {
+            return false;
+        }
+    }
+    if (padded) {
+        width = longest;
     }
+    memcpy(spec, open + 1, spec_len);
+    spec[spec_len] = '\0';
+    if ((width >= CLIPAR_UINT64_STRLEN) || !interval_set_compile(spec, false, &out->values)) {
+        return false;
+    }
+
+    memcpy(out->prefix, arg, prefix_len);
+    out->prefix[prefix_len] = '\0';
+    memcpy(out->suffix, close + 1, suffix_len + 1);
+    out->prefix_len = prefix_len;
+    out->suffix_len = suffix_len;
+    out->width = width;
     return true;
 }
 
+/**
+ * @brief Returns the number of values a range expansion produces.
+ *
+ * @param range The parsed expansion.
+ * @return CLIPAR_UINT64 The value count, saturated at UINT64_MAX.
+ */
+CLIPAR_UINT64 range_expansion_count(const range_expansion_t *range)
+{
+    CLIPAR_UINT64 total = 0;
+    if (range == NULL) {
+        return 0;
+    }
+    for (CLIPAR_SIZE_T i = 0; i < range->values.count; i++) {
+        const CLIPAR_UINT64 width = range->values.hi[i] - range->values.lo[i];
+        if ((width == UINT64_MAX) || (total > (UINT64_MAX - width - 1))) {
+            return UINT64_MAX;
+        }
+        total += width + 1;
+    }
+    return total;
+}
+
+/**
+ * @brief Positions a cursor on the first value of a range expansion.
+ *
+ * @param range The parsed expansion.
+ * @param cur The cursor to initialize.
+ */
+void range_cursor_init(const range_expansion_t *range, range_cursor_t *cur)
+{
+    if ((range == NULL) || (cur == NULL)) {
+        return;
+    }
+    cur->interval = 0;
+    cur->next = (range->values.count != 0) ? range->values.lo[0] : 0;
+}
+
+/**
+ * @brief Fills a batch with the next values of a range expansion.
+ *
+ * @param range The parsed expansion.
+ * @param cur The cursor, advanced past the returned values.
+ * @param values Output array for the values.
+ * @param cap Capacity of the values array.
+ * @return CLIPAR_SIZE_T Number of values written; 0 once the expansion is exhausted.
+ */
+CLIPAR_SIZE_T range_expansion_next(const range_expansion_t *range, range_cursor_t *cur, CLIPAR_UINT64 *values, CLIPAR_SIZE_T cap)
+{
+    CLIPAR_SIZE_T n = 0;
+    if ((range == NULL) || (cur == NULL) || (values == NULL)) {
+        return 0;
+    }
+    while ((n < cap) && (cur->interval < range->values.count)) {
+        values[n++] = cur->next;
+        if (cur->next == range->values.hi[cur->interval]) {
+            if (++cur->interval < range->values.count) {
+                cur->next = range->values.lo[cur->interval];
+            }
+        } else {
+            cur->next++;
+        }
+    }
+    return n;
+}
+
+/**
+ * @brief Formats one expanded item, such as "eth7", from a range expansion and a value.
+ *
+ * @param range The parsed expansion.
+ * @param value A value produced by range_expansion_next().
+ * @param buf Output buffer; always NUL-terminated on success.
+ * @param size Size of the output buffer.
+ * @return CLIPAR_SIZE_T Number of characters written, excluding the NUL; 0 if the buffer is too small.
+ */
+CLIPAR_SIZE_T format_range_item(const range_expansion_t *range, CLIPAR_UINT64 value, CLIPAR_CHAR *buf, CLIPAR_SIZE_T size)
+{
+    if ((range == NULL) || (buf == NULL)) {
+        return 0;
+    }
+    CLIPAR_CHAR tmp[CLIPAR_UINT64_STRLEN];
+    CLIPAR_CHAR *end = tmp + sizeof(tmp);
+    CLIPAR_CHAR *p = write_uint64_backward(end, value);
+    while ((CLIPAR_UINT)(end - p) < range->width) {
+        *--p = '0';
+    }
+    const CLIPAR_SIZE_T digits = (CLIPAR_SIZE_T)(end - p);
+    const CLIPAR_SIZE_T len = range->prefix_len + digits + range->suffix_len;
+    if (size <= len) {
+        return 0;
+    }
+    memcpy(buf, range->prefix, range->prefix_len);
+    memcpy(buf + range->prefix_len, p, digits);
+    memcpy(buf + range->prefix_len + digits, range->suffix, range->suffix_len + 1);
+    return len;
+}
+
 /**
  * @brief Parses an argument using a custom validator callback.
  *
@@ -415,3 +3357,123 @@ CLIPAR_BOOL parse_custom(const CLIPAR_CHAR *arg, custom_parser_t validator, void
     }
     return validator(arg, out);
 }
+
+/**
+ * @brief Computes the memo cache hash of a parser, spec ID and argument text.
+ *
+ * @param parser The parser callback.
+ * @param spec_id The caller-chosen specification ID.
+ * @param arg The argument string.
+ * @param len Pointer to store the argument length.
+ * @return CLIPAR_UINT64 The hash value (never 0, which marks an empty slot).
+ */
+static CLIPAR_UINT64 memo_hash(custom_parser_t parser, CLIPAR_UINT32 spec_id, const CLIPAR_CHAR *arg, CLIPAR_SIZE_T *len)
+{
+    CLIPAR_UINT64 h = fnv1a64(arg, len);
+    CLIPAR_UINT8 bytes[sizeof(parser)];
+    memcpy(bytes, &parser, sizeof(parser));
+    for (CLIPAR_SIZE_T i = 0; i < sizeof(parser); i++) {
+        h = (h ^ bytes[i]) * 1099511628211ULL;
+    }
+    h = (h ^ spec_id) * 1099511628211ULL;
+    h ^= h >> 29;
+    return (h == 0) ? 1 : h;
+}
+
+/**
+ * @brief Initializes an empty memo cache and resets its counters.
+ *
+ * @param cache The cache to initialize.
+ */
+void memo_cache_init(memo_cache_t *cache)
+{
+    if (cache == NULL) {
+        return;
+    }
+    memset(cache, 0, sizeof(*cache));
+}
+
+/**
+ * @brief Parses an argument with a parser callback, reusing the value of an earlier identical call.
+ *
+ * Entries are keyed by the parser, spec_id and the argument bytes and stored in an
+ * open-addressing table with linear probing; the values themselves are appended to a byte
+ * arena, so a parsed range list or interval set is cached as readily as an integer. Only
+ * successful conversions are cached. When the table is three quarters full or the arena
+ * has no room for the value, both are cleared and refilled, which keeps probe sequences
+ * short without tombstones. Arguments longer than CLIPAR_MEMO_KEY_MAX - 1 bytes and values
+ * larger than CLIPAR_MEMO_ARENA_SIZE bytes bypass the cache.
+ *
+ * spec_id must distinguish every parser configuration that can give a different value for
+ * the same text, for example the min/max pair a wrapper passes to a *_in_range parser.
+ *
+ * @param cache The cache (typically one per session or script run).
+ * @param arg The argument string.
+ * @param parser The parser callback.
+ * @param spec_id The caller-chosen specification ID.
+ * @param out Pointer to store the parsed value.
+ * @param out_size Size of the value at out, in bytes.
+ * @return CLIPAR_BOOL true if the argument is valid; false otherwise.
+ */
+CLIPAR_BOOL parse_memoized(memo_cache_t *cache, const CLIPAR_CHAR *arg, custom_parser_t parser, CLIPAR_UINT32 spec_id,
+                           void *out, CLIPAR_SIZE_T out_size)
+{
+    if ((cache == NULL) || (arg == NULL) || (parser == NULL) || (out == NULL)) {
+        return false;
+    }
+    CLIPAR_SIZE_T len = 0;
+    const CLIPAR_UINT64 hash = memo_hash(parser, spec_id, arg, &len);
+    if ((len >= CLIPAR_MEMO_KEY_MAX) || (out_size > CLIPAR_MEMO_ARENA_SIZE)) {
+        cache->misses++;
+        return parser(arg, out);
+    }
+
+    const CLIPAR_SIZE_T mask = CLIPAR_MEMO_SLOTS - 1;
+    CLIPAR_SIZE_T i = (CLIPAR_SIZE_T)hash & mask;
+    for (; cache->slots[i].hash != 0; i = (i + 1) & mask) {
+        const memo_entry_t *e = &cache->slots[i];
+        if ((e->hash == hash) && (e->parser == parser) && (e->spec_id == spec_id) && (e->key_len == len) &&
+            (e->value_len == out_size) && (memcmp(e->key, arg, len) == 0)) {
+            memcpy(out, &cache->values[e->value_offset], out_size);
+            cache->hits++;
+            return true;
+        }
+    }
+
+    cache->misses++;
+    if (!parser(arg, out)) {
+        return false;
+    }
+    if ((cache->used >= ((CLIPAR_MEMO_SLOTS / 4) * 3)) || (out_size > (CLIPAR_MEMO_ARENA_SIZE - cache->values_used))) {
+        memset(cache->slots, 0, sizeof(cache->slots));
+        cache->used = 0;
+        cache->values_used = 0;
+        i = (CLIPAR_SIZE_T)hash & mask;
+    }
+    memo_entry_t *e = &cache->slots[i];
+    e->hash = hash;
+    e->parser = parser;
+    e->spec_id = spec_id;
+    e->key_len = len;
+    e->value_offset = cache->values_used;
+    e->value_len = out_size;
+    memcpy(e->key, arg, len);
+    memcpy(&cache->values[cache->values_used], out, out_size);
+    cache->values_used += out_size;
+    cache->used++;
+    return true;
+}
+
+/**
+ * @brief Returns the fraction of parse_memoized() calls answered from the cache.
+ *
+ * @param cache The cache.
+ * @return CLIPAR_FLOAT The hit rate in [0, 1], or 0 if no calls were made.
+ */
+CLIPAR_FLOAT memo_cache_hit_rate(const memo_cache_t *cache)
+{
+    if ((cache == NULL) || ((cache->hits + cache->misses) == 0)) {
+        return 0;
+    }
+    return (CLIPAR_FLOAT)cache->hits / (CLIPAR_FLOAT)(cache->hits + cache->misses);
+}
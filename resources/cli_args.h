@@ -38,6 +38,64 @@
   #define CLIPAR_UINT64 uint64_t
 #endif
 
+#ifndef CLIPAR_UINT8
+  #include <stdint.h>
+  #define CLIPAR_UINT8 uint8_t
+#endif
+
+#ifndef CLIPAR_INT64
+  #include <stdint.h>
+  #define CLIPAR_INT64 int64_t
+#endif
+
+#ifndef CLIPAR_INTERVAL_SET_MAX
+  #define CLIPAR_INTERVAL_SET_MAX 32
+#endif
+
+#ifndef CLIPAR_GLOB_MAX_PATTERN
+  #define CLIPAR_GLOB_MAX_PATTERN 64
+#endif
+
+#ifndef CLIPAR_GLOB_MAX_SEGMENTS
+  #define CLIPAR_GLOB_MAX_SEGMENTS 8
+#endif
+
+#ifndef CLIPAR_GLOB_MAX_CLASSES
+  #define CLIPAR_GLOB_MAX_CLASSES 4
+#endif
+
+#ifndef CLIPAR_GLOB_CACHE_SIZE
+  #define CLIPAR_GLOB_CACHE_SIZE 8
+#endif
+#if (CLIPAR_GLOB_MAX_PATTERN > 256) || (CLIPAR_GLOB_MAX_SEGMENTS > 255) || (CLIPAR_GLOB_MAX_CLASSES > 256)
+  #error "Glob pattern limits must fit the 8-bit indices of glob_pattern_t"
+#endif
+
+#ifndef CLIPAR_RANGE_AFFIX_MAX
+  #define CLIPAR_RANGE_AFFIX_MAX 32
+#endif
+
+#ifndef CLIPAR_RANGE_SPEC_MAX
+  #define CLIPAR_RANGE_SPEC_MAX 128
+#endif
+
+/* Must be a power of two of at least 4, so the table always keeps an empty slot. */
+#ifndef CLIPAR_MEMO_SLOTS
+  #define CLIPAR_MEMO_SLOTS 256
+#endif
+#if (CLIPAR_MEMO_SLOTS < 4) || ((CLIPAR_MEMO_SLOTS & (CLIPAR_MEMO_SLOTS - 1)) != 0)
+  #error "CLIPAR_MEMO_SLOTS must be a power of two of at least 4"
+#endif
+
+#ifndef CLIPAR_MEMO_KEY_MAX
+  #define CLIPAR_MEMO_KEY_MAX 48
+#endif
+
+/* Bytes of parsed values the memo cache holds, shared by all slots. */
+#ifndef CLIPAR_MEMO_ARENA_SIZE
+  #define CLIPAR_MEMO_ARENA_SIZE 65536
+#endif
+
 #ifndef CLIPAR_FLOAT
   #define CLIPAR_FLOAT float
 #endif
@@ -51,12 +109,19 @@
  * @brief Declarations for CLI argument parsing functions.
  *
  * This header provides a suite of functions for parsing and validating
- * command-line arguments. The functions cover unsigned integers (32-bit and 64-bit),
- * signed integers, string options, IPv4 addresses (with and without netmask),
- * booleans, floating point numbers, hexadecimal values, and custom validator callbacks.
+ * command-line arguments. The functions cover unsigned integers (32-bit, 64-bit
+ * and 128-bit), signed integers, integers checked against interval allow-sets,
+ * string options, IPv4 addresses (with and without netmask), host names, booleans,
+ * floating point numbers, hexadecimal values, timestamps, durations, byte sizes,
+ * UUIDs, base64 data, ports, glob patterns, bracket range expansions and custom
+ * validator callbacks, plus memoized parsing of repeated arguments and
+ * allocation-free formatters for integers and IPv4 addresses.
  *
  * Developers may override the default type definitions by defining the macros
  * (e.g., CLIPAR_BOOL, CLIPAR_INT, etc.) before including this header.
+ * Defining CLIPAR_NO_SIMD when compiling cli_args.c disables the SIMD fast paths.
+ * Defining CLIPAR_NO_OPTION_CACHE disables the per-thread option table index used by
+ * parse_string_option().
  */
 
 /* Function Prototypes */
@@ -72,6 +137,7 @@ CLIPAR_BOOL parse_int_in_range(const CLIPAR_CHAR *arg, CLIPAR_INT min, CLIPAR_IN
 
 /* String option parser: Compares arg to each string in options.
  * On success, returns true and sets out_index to the matching option's index.
+ * Option tables are indexed per thread, so their strings must not change while in use.
  */
 CLIPAR_BOOL parse_string_option(const CLIPAR_CHAR *arg, const CLIPAR_CHAR *options[], CLIPAR_SIZE_T num_options, CLIPAR_UINT *out_index);
 
@@ -81,6 +147,15 @@ CLIPAR_BOOL parse_ip_address(const CLIPAR_CHAR *arg);
 /* IPv4 address with netmask parser: Validates an address of the form "X.X.X.X/Y". */
 CLIPAR_BOOL parse_ip_address_with_netmask(const CLIPAR_CHAR *arg);
 
+/* IPv4 value parsers: Same formats, but also return the host-order address (and prefix length) for the formatters. */
+CLIPAR_BOOL parse_ip_address_value(const CLIPAR_CHAR *arg, CLIPAR_UINT32 *out);
+CLIPAR_BOOL parse_ip_address_with_netmask_value(const CLIPAR_CHAR *arg, CLIPAR_UINT32 *addr, CLIPAR_UINT *prefix_len);
+
+/* Host name parser: Validates an RFC 1123 host name such as "ntp1.example.com".
+ * When allow_ip_literal is true, an IPv4 address "X.X.X.X" is accepted as well.
+ */
+CLIPAR_BOOL parse_hostname(const CLIPAR_CHAR *arg, CLIPAR_BOOL allow_ip_literal);
+
 /* Boolean parser: Accepts "true", "1", "yes" for true and "false", "0", "no" for false (case-insensitive). */
 CLIPAR_BOOL parse_bool(const CLIPAR_CHAR *arg, CLIPAR_BOOL *out);
 
@@ -90,6 +165,156 @@ CLIPAR_BOOL parse_float_in_range(const CLIPAR_CHAR *arg, CLIPAR_FLOAT min, CLIPA
 /* Hexadecimal parser: Parses a hexadecimal number (optional "0x"/"0X" prefix) and validates it is within [min, max]. */
 CLIPAR_BOOL parse_hex_in_range(const CLIPAR_CHAR *arg, CLIPAR_ULONG min, CLIPAR_ULONG max, CLIPAR_ULONG *out);
 
+/* Timestamp parser: Parses an ISO 8601 / RFC 3339 timestamp such as "2026-10-16T12:34:56.789Z"
+ * or "2026-10-16T14:34:56+02:00" into nanoseconds since the Unix epoch.
+ */
+CLIPAR_BOOL parse_timestamp(const CLIPAR_CHAR *arg, CLIPAR_INT64 *epoch_ns);
+
+/* Duration parser: Parses a duration such as "250ms" or "1h30m" into nanoseconds and validates it is within [min, max]. */
+CLIPAR_BOOL parse_duration_ns(const CLIPAR_CHAR *arg, CLIPAR_UINT64 min, CLIPAR_UINT64 max, CLIPAR_UINT64 *out);
+
+/* Byte size parser: Parses a size such as "64KiB" or "2G" into bytes and validates it is within [min, max]. */
+CLIPAR_BOOL parse_size_bytes(const CLIPAR_CHAR *arg, CLIPAR_UINT64 min, CLIPAR_UINT64 max, CLIPAR_UINT64 *out);
+
+/* UUID parser: Parses "xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx" (optionally in braces) into 16 bytes. */
+CLIPAR_BOOL parse_uuid(const CLIPAR_CHAR *arg, CLIPAR_UINT8 out[16]);
+
+/* Batch UUID parser: Parses count UUIDs and returns how many leading entries were valid. */
+CLIPAR_SIZE_T parse_uuid_batch(const CLIPAR_CHAR *args[], CLIPAR_SIZE_T count, CLIPAR_UINT8 out[][16]);
+
+/* Base64 streaming decoder state. Initialize with parse_base64_init(). */
+typedef struct {
+    CLIPAR_UINT32 quad;     /* Sextets of the current incomplete group */
+    CLIPAR_UINT pending;    /* Number of sextets in quad (0-3) */
+    CLIPAR_UINT padding;    /* Number of '=' characters seen (0-2) */
+    CLIPAR_BOOL url_safe;   /* Use the "-_" alphabet instead of "+/" */
+} base64_stream_t;
+
+/* Base64 parsers: Decode len characters of standard ("+/") or URL-safe ("-_") base64 into out.
+ * Fail if the input is invalid or the decoded data does not fit in cap bytes.
+ */
+CLIPAR_BOOL parse_base64(const CLIPAR_CHAR *arg, CLIPAR_SIZE_T len, CLIPAR_UINT8 *out, CLIPAR_SIZE_T cap, CLIPAR_SIZE_T *out_len);
+CLIPAR_BOOL parse_base64url(const CLIPAR_CHAR *arg, CLIPAR_SIZE_T len, CLIPAR_UINT8 *out, CLIPAR_SIZE_T cap, CLIPAR_SIZE_T *out_len);
+
+/* Streaming base64 decoder: Decodes input in chunks into bounded output buffers.
+ * parse_base64_update() stops when the output is full and reports how much input it consumed.
+ */
+void parse_base64_init(base64_stream_t *st, CLIPAR_BOOL url_safe);
+CLIPAR_BOOL parse_base64_update(base64_stream_t *st, const CLIPAR_CHAR *in, CLIPAR_SIZE_T len, CLIPAR_SIZE_T *consumed,
+                                CLIPAR_UINT8 *out, CLIPAR_SIZE_T cap, CLIPAR_SIZE_T *out_len);
+CLIPAR_BOOL parse_base64_final(base64_stream_t *st, CLIPAR_UINT8 *out, CLIPAR_SIZE_T cap, CLIPAR_SIZE_T *out_len);
+
+/* Precompiled set of allowed values: sorted, merged [lo[i], hi[i]] intervals.
+ * Build with interval_set_compile(); signed sets store values as biased keys.
+ */
+typedef struct {
+    CLIPAR_UINT64 lo[CLIPAR_INTERVAL_SET_MAX];
+    CLIPAR_UINT64 hi[CLIPAR_INTERVAL_SET_MAX];
+    CLIPAR_SIZE_T count;
+    CLIPAR_BOOL is_signed;
+} interval_set_t;
+
+/* Interval set compiler: Compiles a specification such as "1-1005,1025-4094" into set. */
+CLIPAR_BOOL interval_set_compile(const CLIPAR_CHAR *spec, CLIPAR_BOOL is_signed, interval_set_t *set);
+
+/* Set-checked integer parsers: Same as the *_in_range parsers, but validate against an interval set. */
+CLIPAR_BOOL parse_uint32_in_set(const CLIPAR_CHAR *arg, const interval_set_t *set, CLIPAR_UINT32 *out);
+CLIPAR_BOOL parse_uint64_in_set(const CLIPAR_CHAR *arg, const interval_set_t *set, CLIPAR_UINT64 *out);
+CLIPAR_BOOL parse_int_in_set(const CLIPAR_CHAR *arg, const interval_set_t *set, CLIPAR_INT *out);
+CLIPAR_BOOL parse_hex_in_set(const CLIPAR_CHAR *arg, const interval_set_t *set, CLIPAR_ULONG *out);
+
+/* Port parser: Accepts a port number (0-65535) or a well-known service name such as "ssh" or "https". */
+CLIPAR_BOOL parse_port(const CLIPAR_CHAR *arg, CLIPAR_UINT32 *out);
+
+/* Unsigned 128-bit value stored as two 64-bit limbs. */
+typedef struct {
+    CLIPAR_UINT64 hi;
+    CLIPAR_UINT64 lo;
+} uint128_value_t;
+
+/* Buffer size that fits any format_uint128() output, including the NUL. */
+#define CLIPAR_UINT128_STRLEN 41
+
+/* Unsigned 128-bit parser: Parses decimal or "0x"-prefixed hex and validates it is within [min, max]. */
+CLIPAR_BOOL parse_uint128_in_range(const CLIPAR_CHAR *arg, uint128_value_t min, uint128_value_t max, uint128_value_t *out);
+
+/* Unsigned 128-bit formatter: Writes decimal or "0x" hex text; returns its length, or 0 if buf is too small. */
+CLIPAR_SIZE_T format_uint128(uint128_value_t value, CLIPAR_BOOL hex, CLIPAR_CHAR *buf, CLIPAR_SIZE_T size);
+
+/* Buffer sizes that fit any output of the formatters below, including the NUL. */
+#define CLIPAR_UINT64_STRLEN 21
+#define CLIPAR_IPV4_STRLEN   19
+
+/* Integer formatters: Write decimal text and return its length, or 0 if buf is too small. */
+CLIPAR_SIZE_T format_uint32(CLIPAR_UINT32 value, CLIPAR_CHAR *buf, CLIPAR_SIZE_T size);
+CLIPAR_SIZE_T format_uint64(CLIPAR_UINT64 value, CLIPAR_CHAR *buf, CLIPAR_SIZE_T size);
+CLIPAR_SIZE_T format_int(CLIPAR_INT value, CLIPAR_CHAR *buf, CLIPAR_SIZE_T size);
+
+/* IPv4 formatters: Write "X.X.X.X" or "X.X.X.X/Y" for a host-order address from parse_ip_address*_value();
+ * return the length, or 0 on error. */
+CLIPAR_SIZE_T format_ip_address(CLIPAR_UINT32 addr, CLIPAR_CHAR *buf, CLIPAR_SIZE_T size);
+CLIPAR_SIZE_T format_ip_address_with_netmask(CLIPAR_UINT32 addr, CLIPAR_UINT prefix_len, CLIPAR_CHAR *buf, CLIPAR_SIZE_T size);
+
+/* Compiled glob pattern: segments between '*' made of literal bytes, '?' and bracket classes.
+ * Build with parse_glob(); the source text is kept as the cache key.
+ */
+typedef struct {
+    CLIPAR_CHAR source[CLIPAR_GLOB_MAX_PATTERN];
+    CLIPAR_UINT64 source_hash;
+    CLIPAR_CHAR literals[CLIPAR_GLOB_MAX_PATTERN];
+    CLIPAR_UINT8 elem_kind[CLIPAR_GLOB_MAX_PATTERN];
+    CLIPAR_UINT8 elem_arg[CLIPAR_GLOB_MAX_PATTERN];
+    CLIPAR_UINT8 seg_start[CLIPAR_GLOB_MAX_SEGMENTS];
+    CLIPAR_UINT8 seg_len[CLIPAR_GLOB_MAX_SEGMENTS];
+    CLIPAR_UINT8 seg_literal_len[CLIPAR_GLOB_MAX_SEGMENTS];
+    CLIPAR_UINT8 classes[CLIPAR_GLOB_MAX_CLASSES][32];
+    CLIPAR_UINT8 num_segments;
+    CLIPAR_UINT8 num_classes;
+} glob_pattern_t;
+
+/* Least-recently-used cache of compiled glob patterns, keyed by pattern text. */
+typedef struct {
+    glob_pattern_t entries[CLIPAR_GLOB_CACHE_SIZE];
+    CLIPAR_UINT64 stamps[CLIPAR_GLOB_CACHE_SIZE];
+    CLIPAR_UINT64 clock;
+    CLIPAR_SIZE_T used;
+} glob_cache_t;
+
+/* Glob compiler: Compiles a pattern such as "eth*" or "Gi0/[1-4]" with fnmatch() semantics. */
+CLIPAR_BOOL parse_glob(const CLIPAR_CHAR *arg, glob_pattern_t *out);
+
+/* Glob matcher: Returns true if the whole name matches the compiled pattern. */
+CLIPAR_BOOL glob_match(const glob_pattern_t *pattern, const CLIPAR_CHAR *name);
+
+/* Glob cache: parse_glob() that reuses the compiled form of recently seen patterns. */
+void glob_cache_init(glob_cache_t *cache);
+CLIPAR_BOOL parse_glob_cached(glob_cache_t *cache, const CLIPAR_CHAR *arg, const glob_pattern_t **out);
+
+/* Parsed bracket range argument such as "eth[0-47]": constant prefix and suffix around a value set. */
+typedef struct {
+    CLIPAR_CHAR prefix[CLIPAR_RANGE_AFFIX_MAX];
+    CLIPAR_CHAR suffix[CLIPAR_RANGE_AFFIX_MAX];
+    CLIPAR_SIZE_T prefix_len;
+    CLIPAR_SIZE_T suffix_len;
+    CLIPAR_UINT width;
+    interval_set_t values;
+} range_expansion_t;
+
+/* Iteration state for range_expansion_next(). */
+typedef struct {
+    CLIPAR_SIZE_T interval;
+    CLIPAR_UINT64 next;
+} range_cursor_t;
+
+/* Range expansion parser: Parses one "[lo-hi,...]" group once; values are then read in batches. */
+CLIPAR_BOOL parse_range_expansion(const CLIPAR_CHAR *arg, range_expansion_t *out);
+CLIPAR_UINT64 range_expansion_count(const range_expansion_t *range);
+void range_cursor_init(const range_expansion_t *range, range_cursor_t *cur);
+CLIPAR_SIZE_T range_expansion_next(const range_expansion_t *range, range_cursor_t *cur, CLIPAR_UINT64 *values, CLIPAR_SIZE_T cap);
+
+/* Range item formatter: Writes prefix, zero-padded value and suffix; returns the length, or 0 if buf is too small. */
+CLIPAR_SIZE_T format_range_item(const range_expansion_t *range, CLIPAR_UINT64 value, CLIPAR_CHAR *buf, CLIPAR_SIZE_T size);
+
 /* Custom parser callback type.
  * The custom validator function should follow this signature.
  */
@@ -98,4 +323,33 @@ typedef CLIPAR_BOOL (*custom_parser_t)(const CLIPAR_CHAR *arg, void *out);
 /* Custom parser wrapper function */
 CLIPAR_BOOL parse_custom(const CLIPAR_CHAR *arg, custom_parser_t validator, void *out);
 
+/* One memoized conversion: parser, spec ID and argument bytes, and where its value is stored. */
+typedef struct {
+    CLIPAR_UINT64 hash;
+    custom_parser_t parser;
+    CLIPAR_UINT32 spec_id;
+    CLIPAR_SIZE_T key_len;
+    CLIPAR_SIZE_T value_offset;  /* Into memo_cache_t.values */
+    CLIPAR_SIZE_T value_len;
+    CLIPAR_CHAR key[CLIPAR_MEMO_KEY_MAX];
+} memo_entry_t;
+
+/* Open-addressing memo cache of parsed values with hit/miss counters.
+ * Values live in one arena so that large results (range lists, sets, globs) fit as well.
+ */
+typedef struct {
+    memo_entry_t slots[CLIPAR_MEMO_SLOTS];
+    CLIPAR_SIZE_T used;
+    CLIPAR_UINT8 values[CLIPAR_MEMO_ARENA_SIZE];
+    CLIPAR_SIZE_T values_used;
+    CLIPAR_UINT64 hits;
+    CLIPAR_UINT64 misses;
+} memo_cache_t;
+
+/* Memoized parser: Calls parser only for argument text not seen before with the same spec_id. */
+void memo_cache_init(memo_cache_t *cache);
+CLIPAR_BOOL parse_memoized(memo_cache_t *cache, const CLIPAR_CHAR *arg, custom_parser_t parser, CLIPAR_UINT32 spec_id,
+                           void *out, CLIPAR_SIZE_T out_size);
+CLIPAR_FLOAT memo_cache_hit_rate(const memo_cache_t *cache);
+
 #endif // CLI_ARGS_H
@@ -0,0 +1,229 @@
+/**
+ * @file base64_bench.c
+ * @brief Reference check and benchmark for the one-shot and streaming base64 decoders.
+ *
+ * Encodes random byte strings with a straightforward reference encoder (both alphabets,
+ * with and without padding) and checks that parse_base64() / parse_base64url() and the
+ * streaming decoder, fed random chunk and buffer sizes, return the original bytes. One
+ * corrupted character must make each input invalid. Every byte value is also tried in
+ * every position of a 64-character block, which covers each SIMD lane. Finally measures
+ * decoding throughput on 1 MiB of data.
+ *
+ * Build and run from the repository root, once per decoder:
+ *   cc -O2 -std=c99 -mssse3 -Iresources test/bench/base64_bench.c resources/cli_args.c -o base64_bench
+ *   cc -O2 -std=c99 -DCLIPAR_NO_SIMD -Iresources test/bench/base64_bench.c resources/cli_args.c -o base64_bench
+ *   ./base64_bench
+ *
+ * Exits with status 1 if any result disagrees with the reference.
+ */
+#define _POSIX_C_SOURCE 199309L
+
+#include "cli_args.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+
+#define CHECK_ITERATIONS 200000
+#define CHECK_MAX_BYTES  300
+#define BENCH_BYTES      (1u << 20)
+#define BENCH_REPEATS    50
+
+static const char standard_alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+static const char url_alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+static uint64_t rng_state = 88172645463325252ULL;
+static long failures = 0;
+
+/**
+ * @brief Returns the next value of a xorshift64 generator (deterministic across runs).
+ */
+static uint64_t next_random(void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return rng_state;
+}
+
+/**
+ * @brief Returns the current monotonic time in nanoseconds.
+ */
+static double now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((double)ts.tv_sec * 1e9) + (double)ts.tv_nsec;
+}
+
+/**
+ * @brief Reference encoder: one 3-byte group at a time, optional '=' padding.
+ *
+ * @return size_t Number of characters written (a terminator is added).
+ */
+static size_t reference_encode(const uint8_t *in, size_t n, char *out, const char *alphabet, int pad)
+{
+    size_t j = 0;
+    for (size_t i = 0; i < n; i += 3) {
+        uint32_t v = ((uint32_t)in[i] << 16) | ((i + 1 < n) ? ((uint32_t)in[i + 1] << 8) : 0u) |
+                     ((i + 2 < n) ? (uint32_t)in[i + 2] : 0u);
+        out[j++] = alphabet[v >> 18];
+        out[j++] = alphabet[(v >> 12) & 63u];
+        if (i + 1 < n) {
+            out[j++] = alphabet[(v >> 6) & 63u];
+        } else if (pad) {
+            out[j++] = '=';
+        }
+        if (i + 2 < n) {
+            out[j++] = alphabet[v & 63u];
+        } else if (pad) {
+            out[j++] = '=';
+        }
+    }
+    out[j] = '\0';
+    return j;
+}
+
+/**
+ * @brief Records a failure with a short description.
+ */
+static void fail(const char *what, const char *text)
+{
+    if (failures++ < 10) {
+        printf("%s: \"%.80s\"\n", what, text);
+    }
+}
+
+/**
+ * @brief Decodes text with the one-shot decoder for the given alphabet.
+ */
+static CLIPAR_BOOL decode(int url, const char *text, size_t len, uint8_t *out, size_t cap, size_t *out_len)
+{
+    return url ? parse_base64url(text, len, out, cap, out_len) : parse_base64(text, len, out, cap, out_len);
+}
+
+/**
+ * @brief Decodes text through the streaming API with random chunk and buffer sizes.
+ *
+ * @return size_t Number of bytes decoded, or (size_t)-1 on error.
+ */
+static size_t decode_streaming(int url, const char *text, size_t len, uint8_t *out)
+{
+    base64_stream_t st;
+    size_t pos = 0;
+    size_t total = 0;
+    parse_base64_init(&st, url != 0);
+    while (pos < len) {
+        size_t chunk = 1 + (size_t)(next_random() % 40);
+        size_t cap = 3 + (size_t)(next_random() % 20);
+        size_t consumed = 0;
+        size_t written = 0;
+        if (chunk > (len - pos)) {
+            chunk = len - pos;
+        }
+        if (!parse_base64_update(&st, text + pos, chunk, &consumed, out + total, cap, &written)) {
+            return (size_t)-1;
+        }
+        pos += consumed;
+        total += written;
+    }
+    size_t written = 0;
+    if (!parse_base64_final(&st, out + total, 3, &written)) {
+        return (size_t)-1;
+    }
+    return total + written;
+}
+
+int main(void)
+{
+    static uint8_t in[CHECK_MAX_BYTES];
+    static uint8_t out[CHECK_MAX_BYTES + 64];
+    static char text[(CHECK_MAX_BYTES * 4 / 3) + 8];
+    size_t out_len = 0;
+
+    for (long it = 0; it < CHECK_ITERATIONS; it++) {
+        size_t n = 1 + (size_t)(next_random() % CHECK_MAX_BYTES);
+        for (size_t i = 0; i < n; i++) {
+            in[i] = (uint8_t)next_random();
+        }
+        int url = (int)(next_random() & 1u);
+        int pad = (int)(next_random() & 1u);
+        const char *alphabet = url ? url_alphabet : standard_alphabet;
+        size_t len = reference_encode(in, n, text, alphabet, pad);
+
+        if (!decode(url, text, len, out, sizeof(out), &out_len) || (out_len != n) || (memcmp(in, out, n) != 0)) {
+            fail("decode mismatch", text);
+        }
+        /* An output buffer of exactly n bytes is enough, one byte less is not. */
+        if (!decode(url, text, len, out, n, &out_len) || (out_len != n)) {
+            fail("exact-size buffer rejected", text);
+        }
+        if (decode(url, text, len, out, n - 1, &out_len)) {
+            fail("short buffer accepted", text);
+        }
+        if ((decode_streaming(url, text, len, out) != n) || (memcmp(in, out, n) != 0)) {
+            fail("streaming mismatch", text);
+        }
+
+        size_t pos = (size_t)(next_random() % len);
+        int c;
+        do {
+            c = 1 + (int)(next_random() % 255);
+        } while ((c == '=') || (strchr(alphabet, c) != NULL));
+        char save = text[pos];
+        text[pos] = (char)c;
+        if (decode(url, text, len, out, sizeof(out), &out_len)) {
+            fail("corrupted input accepted", text);
+        }
+        text[pos] = save;
+    }
+
+    /* Every byte value in every position of a 64-character block ('=' is valid padding only at the end). */
+    char block[65];
+    char again[80];
+    for (int b = 1; b < 256; b++) {
+        for (int k = 0; k < 64; k++) {
+            memset(block, 'A', 64);
+            block[64] = '\0';
+            block[k] = (char)b;
+            int want = (strchr(standard_alphabet, b) != NULL) || ((b == '=') && (k == 63));
+            int got = parse_base64(block, 64, out, sizeof(out), &out_len) ? 1 : 0;
+            if (got != want) {
+                fail("lane classification", block);
+            } else if (got) {
+                reference_encode(out, out_len, again, standard_alphabet, 1);
+                if (memcmp(again, block, 64) != 0) {
+                    fail("lane value", block);
+                }
+            }
+        }
+    }
+
+    static const char *const bad[] = { "QR==", "Q===", "Q", "QQ=A", "QQ==QQ==", "QUJD=", "QQ=" };
+    for (size_t i = 0; i < (sizeof(bad) / sizeof(bad[0])); i++) {
+        if (parse_base64(bad[i], strlen(bad[i]), out, sizeof(out), &out_len)) {
+            fail("invalid input accepted", bad[i]);
+        }
+    }
+    printf("reference check: %d inputs, %ld mismatches\n", CHECK_ITERATIONS, failures);
+
+    static uint8_t big[BENCH_BYTES];
+    static char big_text[(BENCH_BYTES / 3 * 4) + 8];
+    static uint8_t big_out[BENCH_BYTES + 64];
+    for (size_t i = 0; i < BENCH_BYTES; i++) {
+        big[i] = (uint8_t)next_random();
+    }
+    size_t big_len = reference_encode(big, BENCH_BYTES, big_text, standard_alphabet, 1);
+    double best = 1e30;
+    for (int rep = 0; rep < BENCH_REPEATS; rep++) {
+        double t0 = now_ns();
+        parse_base64(big_text, big_len, big_out, sizeof(big_out), &out_len);
+        double elapsed = now_ns() - t0;
+        best = (elapsed < best) ? elapsed : best;
+    }
+    if ((out_len != BENCH_BYTES) || (memcmp(big, big_out, BENCH_BYTES) != 0)) {
+        fail("1 MiB decode mismatch", "");
+    }
+    printf("decode %zu characters: %.2f GB/s of input\n", big_len, (double)big_len / best);
+    return (failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,201 @@
+/**
+ * @file format_bench.c
+ * @brief Reference check and benchmark for the integer and IPv4 formatters.
+ *
+ * Compares format_uint32(), format_uint64(), format_int(), format_ip_address() and
+ * format_ip_address_with_netmask() with sprintf() on random values, checks that IPv4
+ * text survives a parse_ip_address*_value() / format round trip, then renders a
+ * 100k-entry running configuration (three lines per entry) with sprintf() and with
+ * the formatters into one preallocated buffer.
+ *
+ * Build and run from the repository root:
+ *   cc -O2 -std=c99 -Iresources test/bench/format_bench.c resources/cli_args.c -o format_bench
+ *   ./format_bench
+ *
+ * Exits with status 1 if any output disagrees with the reference.
+ */
+#define _POSIX_C_SOURCE 199309L
+
+#include "cli_args.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+
+#define CHECK_ITERATIONS 5000000
+#define RENDER_ENTRIES   100000
+#define RENDER_REPEATS   10
+#define RENDER_LINE_MAX  128
+
+static uint64_t rng_state = 88172645463325252ULL;
+static long failures = 0;
+
+/**
+ * @brief Returns the next value of a xorshift64 generator (deterministic across runs).
+ */
+static uint64_t next_random(void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return rng_state;
+}
+
+/**
+ * @brief Returns the current monotonic time in nanoseconds.
+ */
+static double now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((double)ts.tv_sec * 1e9) + (double)ts.tv_nsec;
+}
+
+/**
+ * @brief Records a mismatch between formatter output and the sprintf() reference.
+ */
+static void expect_same(const char *what, const char *got, size_t got_len, const char *expect)
+{
+    if ((got_len != strlen(expect)) || (strcmp(got, expect) != 0)) {
+        if (failures++ < 5) {
+            printf("%s mismatch: \"%s\" vs \"%s\"\n", what, got, expect);
+        }
+    }
+}
+
+/**
+ * @brief Checks every formatter against sprintf() on random inputs.
+ */
+static void check_formatters(void)
+{
+    char got[64];
+    char expect[64];
+
+    for (long i = 0; i < CHECK_ITERATIONS; i++) {
+        /* Random bit lengths so that every digit count occurs. */
+        uint64_t v = next_random() >> (next_random() % 64);
+        uint32_t addr = (uint32_t)next_random();
+        unsigned prefix = (unsigned)(next_random() % 33);
+        int s = (int)(uint32_t)(v >> (next_random() % 32));
+        size_t n;
+
+        n = format_uint64(v, got, sizeof(got));
+        sprintf(expect, "%llu", (unsigned long long)v);
+        expect_same("format_uint64", got, n, expect);
+
+        n = format_uint32((uint32_t)v, got, sizeof(got));
+        sprintf(expect, "%lu", (unsigned long)(uint32_t)v);
+        expect_same("format_uint32", got, n, expect);
+
+        n = format_int(s, got, sizeof(got));
+        sprintf(expect, "%d", s);
+        expect_same("format_int", got, n, expect);
+
+        sprintf(expect, "%u.%u.%u.%u", (unsigned)(addr >> 24), (unsigned)((addr >> 16) & 0xFFu),
+                (unsigned)((addr >> 8) & 0xFFu), (unsigned)(addr & 0xFFu));
+        n = format_ip_address(addr, got, sizeof(got));
+        expect_same("format_ip_address", got, n, expect);
+
+        CLIPAR_UINT32 parsed = 0;
+        if (!parse_ip_address_value(expect, &parsed) || (parsed != addr)) {
+            if (failures++ < 5) {
+                printf("parse_ip_address_value mismatch: %s\n", expect);
+            }
+        }
+
+        sprintf(expect + strlen(expect), "/%u", prefix);
+        n = format_ip_address_with_netmask(addr, prefix, got, sizeof(got));
+        expect_same("format_ip_address_with_netmask", got, n, expect);
+
+        CLIPAR_UINT parsed_prefix = 0;
+        if (!parse_ip_address_with_netmask_value(expect, &parsed, &parsed_prefix) || (parsed != addr) ||
+            (parsed_prefix != prefix)) {
+            if (failures++ < 5) {
+                printf("parse_ip_address_with_netmask_value mismatch: %s\n", expect);
+            }
+        }
+    }
+
+    /* Buffers one byte too small must be rejected rather than truncated. */
+    char small[CLIPAR_UINT64_STRLEN];
+    if ((format_uint64(UINT64_MAX, small, CLIPAR_UINT64_STRLEN) != 20) ||
+        (format_uint64(UINT64_MAX, small, CLIPAR_UINT64_STRLEN - 1) != 0) ||
+        (format_ip_address_with_netmask(0xFFFFFFFFu, 32, small, CLIPAR_IPV4_STRLEN) != 18) ||
+        (format_ip_address_with_netmask(0xFFFFFFFFu, 33, small, CLIPAR_IPV4_STRLEN) != 0)) {
+        failures++;
+        printf("buffer size check failed\n");
+    }
+    printf("reference check: %d values per formatter, %ld mismatches\n", CHECK_ITERATIONS, failures);
+}
+
+int main(void)
+{
+    check_formatters();
+
+    static uint32_t vlan[RENDER_ENTRIES];
+    static uint32_t addr[RENDER_ENTRIES];
+    static uint32_t prefix[RENDER_ENTRIES];
+    static uint32_t mtu[RENDER_ENTRIES];
+    for (int i = 0; i < RENDER_ENTRIES; i++) {
+        vlan[i] = 1 + (uint32_t)(next_random() % 4094);
+        addr[i] = (uint32_t)next_random();
+        prefix[i] = (uint32_t)(next_random() % 33);
+        mtu[i] = 576 + (uint32_t)(next_random() % 9000);
+    }
+
+    const size_t cap = (size_t)RENDER_ENTRIES * RENDER_LINE_MAX;
+    char *reference = malloc(cap);
+    char *out = malloc(cap);
+    if ((reference == NULL) || (out == NULL)) {
+        return 1;
+    }
+    double best_sprintf = 1e30;
+    double best_format = 1e30;
+    size_t reference_len = 0;
+    size_t out_len = 0;
+
+    for (int rep = 0; rep < RENDER_REPEATS; rep++) {
+        double t0 = now_ns();
+        char *p = reference;
+        for (int i = 0; i < RENDER_ENTRIES; i++) {
+            p += sprintf(p, "interface Vlan%u\n ip address %u.%u.%u.%u/%u\n mtu %u\n", (unsigned)vlan[i],
+                         (unsigned)(addr[i] >> 24), (unsigned)((addr[i] >> 16) & 0xFFu),
+                         (unsigned)((addr[i] >> 8) & 0xFFu), (unsigned)(addr[i] & 0xFFu), (unsigned)prefix[i],
+                         (unsigned)mtu[i]);
+        }
+        double elapsed = now_ns() - t0;
+        best_sprintf = (elapsed < best_sprintf) ? elapsed : best_sprintf;
+        reference_len = (size_t)(p - reference);
+
+        t0 = now_ns();
+        p = out;
+        char *end = out + cap;
+        for (int i = 0; i < RENDER_ENTRIES; i++) {
+            memcpy(p, "interface Vlan", 14);
+            p += 14;
+            p += format_uint32(vlan[i], p, (size_t)(end - p));
+            memcpy(p, "\n ip address ", 13);
+            p += 13;
+            p += format_ip_address_with_netmask(addr[i], prefix[i], p, (size_t)(end - p));
+            memcpy(p, "\n mtu ", 6);
+            p += 6;
+            p += format_uint32(mtu[i], p, (size_t)(end - p));
+            *p++ = '\n';
+        }
+        elapsed = now_ns() - t0;
+        best_format = (elapsed < best_format) ? elapsed : best_format;
+        out_len = (size_t)(p - out);
+    }
+
+    if ((out_len != reference_len) || (memcmp(out, reference, out_len) != 0)) {
+        failures++;
+        printf("rendered configuration differs from sprintf output\n");
+    }
+    printf("render %d entries (%d lines, %zu bytes): sprintf %.2f ms, formatters %.2f ms\n", RENDER_ENTRIES,
+           RENDER_ENTRIES * 3, out_len, best_sprintf / 1e6, best_format / 1e6);
+
+    free(reference);
+    free(out);
+    return (failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,211 @@
+/**
+ * @file glob_bench.c
+ * @brief Reference check and benchmark for parse_glob(), glob_match() and parse_glob_cached().
+ *
+ * Compares glob_match() with fnmatch() (no flags) on random patterns built from the
+ * glob metacharacters and a few literals, matched against random names over an
+ * overlapping alphabet. Patterns that parse_glob() rejects must be the malformed ones
+ * (trailing '\' or unterminated '['). Also checks that the cache returns a pattern
+ * equivalent to a fresh compile after evictions, then times matching against fnmatch()
+ * and a cache hit against a compile. Requires a libc with fnmatch().
+ *
+ * Build and run from the repository root:
+ *   cc -O2 -std=c99 -Iresources test/bench/glob_bench.c resources/cli_args.c -o glob_bench
+ *   ./glob_bench
+ *
+ * Exits with status 1 if any result disagrees with the reference.
+ */
+#define _POSIX_C_SOURCE 199309L
+
+#include "cli_args.h"
+#include <fnmatch.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+
+#define CHECK_ITERATIONS 3000000
+#define BENCH_ITERATIONS 2000000
+
+static uint64_t rng_state = 88172645463325252ULL;
+static long failures = 0;
+
+/**
+ * @brief Returns the next value of a xorshift64 generator (deterministic across runs).
+ */
+static uint64_t next_random(void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return rng_state;
+}
+
+/**
+ * @brief Returns the current monotonic time in nanoseconds.
+ */
+static double now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((double)ts.tv_sec * 1e9) + (double)ts.tv_nsec;
+}
+
+/**
+ * @brief Reference validity: no trailing unescaped '\' and every '[' closed ('\' escapes inside brackets too).
+ *
+ * fnmatch() treats these as literals instead of failing, so they are compared separately.
+ */
+static int reference_valid(const char *p)
+{
+    while (*p != '\0') {
+        if (*p == '\\') {
+            if (p[1] == '\0') {
+                return 0;
+            }
+            p += 2;
+        } else if (*p == '[') {
+            const char *q = p + 1;
+            if ((*q == '!') || (*q == '^')) {
+                q++;
+            }
+            if (*q == ']') {
+                q++;
+            }
+            while ((*q != '\0') && (*q != ']')) {
+                q += ((q[0] == '\\') && (q[1] != '\0')) ? 2 : 1;
+            }
+            if (*q == '\0') {
+                return 0;
+            }
+            p = q + 1;
+        } else {
+            p++;
+        }
+    }
+    return 1;
+}
+
+/**
+ * @brief Compares one pattern/name pair with fnmatch().
+ */
+static void check_pair(const char *pattern, const char *name)
+{
+    glob_pattern_t g;
+    int valid = parse_glob(pattern, &g) ? 1 : 0;
+    if (valid != reference_valid(pattern)) {
+        if (failures++ < 10) {
+            printf("parse_glob(\"%s\") = %d\n", pattern, valid);
+        }
+        return;
+    }
+    if (valid) {
+        int got = glob_match(&g, name) ? 1 : 0;
+        int want = (fnmatch(pattern, name, 0) == 0) ? 1 : 0;
+        if (got != want) {
+            if (failures++ < 10) {
+                printf("glob_match(\"%s\", \"%s\") = %d, fnmatch = %d\n", pattern, name, got, want);
+            }
+        }
+    }
+}
+
+int main(void)
+{
+    static const char *const fixed[][2] = {
+        { "eth1/*", "eth1/3" }, { "Gi0/[1-4]", "Gi0/3" }, { "Gi0/[1-4]", "Gi0/5" }, { "*", "" },
+        { "a*b*c", "axxbyyc" }, { "[]a]", "]" }, { "[!a]", "b" }, { "\\*", "*" }, { "[a-]", "-" },
+        { "*Ethernet*/1", "TenGigabitEthernet1/0/1" }, { "Vlan1??", "Vlan100" }, { "a*a*a*b", "aaaaaaaaaaaaaaaa" }
+    };
+    for (size_t i = 0; i < (sizeof(fixed) / sizeof(fixed[0])); i++) {
+        check_pair(fixed[i][0], fixed[i][1]);
+    }
+
+    /* Random patterns over metacharacters, so classes, escapes and stars interact often. */
+    static const char pattern_alphabet[] = "ab/-*?[]!^\\0";
+    static const char name_alphabet[] = "ab/-]!0c";
+    char pattern[16];
+    char name[16];
+    long valid = 0;
+    for (long it = 0; it < CHECK_ITERATIONS; it++) {
+        size_t pattern_len = 1 + (size_t)(next_random() % 12);
+        size_t name_len = (size_t)(next_random() % 14);
+        for (size_t i = 0; i < pattern_len; i++) {
+            pattern[i] = pattern_alphabet[next_random() % (sizeof(pattern_alphabet) - 1)];
+        }
+        pattern[pattern_len] = '\0';
+        for (size_t i = 0; i < name_len; i++) {
+            name[i] = name_alphabet[next_random() % (sizeof(name_alphabet) - 1)];
+        }
+        name[name_len] = '\0';
+        valid += reference_valid(pattern);
+        check_pair(pattern, name);
+    }
+    printf("reference check: %d pattern/name pairs (%ld valid patterns), %ld mismatches\n", CHECK_ITERATIONS, valid,
+           failures);
+
+    /* Cache: after hits and evictions, every returned pattern must behave like a fresh compile. */
+    static const char *const probes[] = { "x1", "x15abc7", "x12", "x7z9", "y3" };
+    static glob_cache_t cache;
+    const glob_pattern_t *cached = NULL;
+    glob_pattern_t fresh;
+    char text[32];
+    glob_cache_init(&cache);
+    for (int i = 0; i < (3 * CLIPAR_GLOB_CACHE_SIZE); i++) {
+        sprintf(text, "x%d*[0-9]", i % (CLIPAR_GLOB_CACHE_SIZE + 3));
+        int ok = parse_glob_cached(&cache, text, &cached) && parse_glob(text, &fresh) && (strcmp(cached->source, text) == 0);
+        for (size_t k = 0; ok && (k < (sizeof(probes) / sizeof(probes[0]))); k++) {
+            ok = (glob_match(cached, probes[k]) == glob_match(&fresh, probes[k]));
+        }
+        if (!ok) {
+            if (failures++ < 10) {
+                printf("parse_glob_cached(\"%s\") returned a wrong pattern\n", text);
+            }
+        }
+    }
+    if (parse_glob_cached(&cache, "[abc", &cached) || (cache.used > CLIPAR_GLOB_CACHE_SIZE)) {
+        failures++;
+        printf("glob cache accepted an invalid pattern or overflowed\n");
+    }
+
+    static const char *const names[] = { "GigabitEthernet0/1", "GigabitEthernet0/2", "TenGigabitEthernet1/0/1",
+                                         "Loopback0", "eth1/17", "Vlan100" };
+    static const char *const patterns[] = { "Gig*0/[1-4]", "eth1/*", "*Ethernet*/1", "Vlan1??" };
+    glob_pattern_t compiled[4];
+    for (int i = 0; i < 4; i++) {
+        parse_glob(patterns[i], &compiled[i]);
+    }
+    volatile long sink = 0;
+
+    double t0 = now_ns();
+    for (int r = 0; r < BENCH_ITERATIONS; r++) {
+        for (int i = 0; i < 4; i++) {
+            sink += glob_match(&compiled[i], names[r % 6]);
+        }
+    }
+    double match_ns = (now_ns() - t0) / (4.0 * BENCH_ITERATIONS);
+
+    t0 = now_ns();
+    for (int r = 0; r < BENCH_ITERATIONS; r++) {
+        for (int i = 0; i < 4; i++) {
+            sink += (fnmatch(patterns[i], names[r % 6], 0) == 0);
+        }
+    }
+    double fnmatch_ns = (now_ns() - t0) / (4.0 * BENCH_ITERATIONS);
+
+    t0 = now_ns();
+    for (int r = 0; r < BENCH_ITERATIONS; r++) {
+        sink += parse_glob_cached(&cache, patterns[r & 3], &cached);
+    }
+    double hit_ns = (now_ns() - t0) / BENCH_ITERATIONS;
+
+    t0 = now_ns();
+    for (int r = 0; r < BENCH_ITERATIONS; r++) {
+        sink += parse_glob(patterns[r & 3], &compiled[0]);
+    }
+    double compile_ns = (now_ns() - t0) / BENCH_ITERATIONS;
+
+    printf("glob_match %.1f ns, fnmatch %.1f ns; cache hit %.1f ns, compile %.1f ns\n", match_ns, fnmatch_ns, hit_ns,
+           compile_ns);
+    return (failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,175 @@
+/**
+ * @file hostname_check.c
+ * @brief Reference check for parse_hostname().
+ *
+ * Runs fixed RFC 1123 and IPv4-literal cases, then compares parse_hostname() with a
+ * straightforward reference implementation on random strings built from host name
+ * characters, dots and digits.
+ *
+ * Build and run from the repository root:
+ *   cc -O2 -std=c99 -Iresources test/bench/hostname_check.c resources/cli_args.c -o hostname_check
+ *   ./hostname_check
+ *
+ * Exits with status 1 if any result disagrees with the expectation.
+ */
+#include "cli_args.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+
+#define RANDOM_ITERATIONS 5000000
+
+static uint64_t rng_state = 88172645463325252ULL;
+static long failures = 0;
+
+/**
+ * @brief Returns the next value of a xorshift64 generator (deterministic across runs).
+ */
+static uint64_t next_random(void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return rng_state;
+}
+
+/**
+ * @brief Records a failure if parse_hostname() does not return the expected result.
+ */
+static void expect(const char *arg, int allow_ip, int valid)
+{
+    if ((parse_hostname(arg, allow_ip != 0) ? 1 : 0) != valid) {
+        if (failures++ < 10) {
+            printf("parse_hostname(\"%s\", %d) should be %s\n", arg, allow_ip, valid ? "valid" : "invalid");
+        }
+    }
+}
+
+/**
+ * @brief Reference RFC 1123 check: labels of 1-63 letters, digits and inner hyphens,
+ *        at most 253 characters plus an optional trailing dot, and not all-numeric in
+ *        the last label.
+ */
+static int reference_hostname(const char *s)
+{
+    size_t len = strlen(s);
+    if ((len > 0) && (s[len - 1] == '.')) {
+        len--;
+    }
+    if ((len == 0) || (len > 253)) {
+        return 0;
+    }
+    size_t start = 0;
+    int last_all_digits = 1;
+    while (start <= len) {
+        size_t end = start;
+        while ((end < len) && (s[end] != '.')) {
+            end++;
+        }
+        size_t n = end - start;
+        if ((n == 0) || (n > 63) || (s[start] == '-') || (s[end - 1] == '-')) {
+            return 0;
+        }
+        last_all_digits = 1;
+        for (size_t i = start; i < end; i++) {
+            char c = s[i];
+            int alpha = ((c >= 'a') && (c <= 'z')) || ((c >= 'A') && (c <= 'Z'));
+            int digit = (c >= '0') && (c <= '9');
+            if (!alpha && !digit && (c != '-')) {
+                return 0;
+            }
+            if (!digit) {
+                last_all_digits = 0;
+            }
+        }
+        start = end + 1;
+    }
+    return !last_all_digits;
+}
+
+/**
+ * @brief Reference IPv4 literal check: exactly four non-empty decimal octets of at most
+ *        255, at most 15 characters in total.
+ */
+static int reference_ipv4(const char *s)
+{
+    if (strlen(s) > 15) {
+        return 0;
+    }
+    for (int octet = 0; octet < 4; octet++) {
+        if ((octet != 0) && (*s++ != '.')) {
+            return 0;
+        }
+        unsigned value = 0;
+        const char *digits = s;
+        while ((*s >= '0') && (*s <= '9')) {
+            value = (value * 10) + (unsigned)(*s++ - '0');
+            if (value > 255) {
+                return 0;
+            }
+        }
+        if (s == digits) {
+            return 0;
+        }
+    }
+    return (*s == '\0');
+}
+
+int main(void)
+{
+    static const char *const good[] = { "a", "ntp1.example.com", "example.com.", "a-b.c", "1a.b2", "xn--bcher-kva.ch" };
+    static const char *const bad[] = { "", ".", "-a", "a-", "a..b", "a_b", "1.2.3.4", "a.123", "exa mple", ".a" };
+    static const char *const bad_ip[] = { "1..2.3.4", ".1.2.3.4", "1.2.3.4.", "1.2.3", "1.2.3.4.5", "256.1.1.1",
+                                          "1.2.3.-4", "1.2.3.4/8", "0001.2.3.4.5" };
+    char name[300];
+
+    for (size_t i = 0; i < (sizeof(good) / sizeof(good[0])); i++) {
+        expect(good[i], 0, 1);
+        expect(good[i], 1, 1);
+    }
+    for (size_t i = 0; i < (sizeof(bad) / sizeof(bad[0])); i++) {
+        expect(bad[i], 0, 0);
+    }
+    for (size_t i = 0; i < (sizeof(bad_ip) / sizeof(bad_ip[0])); i++) {
+        expect(bad_ip[i], 1, 0);
+    }
+    expect("1.2.3.4", 1, 1);
+    expect("255.255.255.255", 1, 1);
+    expect("010.0.0.1", 1, 1);
+
+    /* Label and name length limits. */
+    memset(name, 'a', 63);
+    name[63] = '\0';
+    expect(name, 0, 1);
+    name[63] = 'a';
+    name[64] = '\0';
+    expect(name, 0, 0);
+    for (int i = 0; i < 253; i++) {
+        name[i] = ((i % 50) == 49) ? '.' : 'a';
+    }
+    name[253] = '\0';
+    expect(name, 0, 1);
+    name[253] = '.';
+    name[254] = '\0';
+    expect(name, 0, 1);
+    name[253] = 'a';
+    expect(name, 0, 0);
+
+    /* Random strings over a small alphabet, so that edge cases are frequent. */
+    static const char alphabet[] = "ab9-.0155";
+    long valid = 0;
+    for (long it = 0; it < RANDOM_ITERATIONS; it++) {
+        size_t n = (size_t)(next_random() % 18);
+        for (size_t i = 0; i < n; i++) {
+            name[i] = alphabet[next_random() % (sizeof(alphabet) - 1)];
+        }
+        name[n] = '\0';
+        int allow_ip = (int)(next_random() & 1u);
+        int want = reference_hostname(name) || (allow_ip && reference_ipv4(name));
+        valid += want;
+        expect(name, allow_ip, want);
+    }
+
+    printf("hostname check: %d random strings (%ld valid), %ld mismatches\n", RANDOM_ITERATIONS, valid, failures);
+    return (failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,144 @@
+/**
+ * @file interval_set_check.c
+ * @brief Reference check for interval_set_compile() and the *_in_set() parsers.
+ *
+ * Builds random specifications over a small value domain, in random order and with
+ * overlapping, adjacent and duplicate entries, and compares membership with a bitmap of
+ * the listed values. A specification must compile exactly when its merged intervals fit
+ * in CLIPAR_INTERVAL_SET_MAX, however many entries it lists.
+ *
+ * Build and run from the repository root:
+ *   cc -O2 -std=c99 -Iresources test/bench/interval_set_check.c resources/cli_args.c -o interval_set_check
+ *   ./interval_set_check
+ *
+ * Exits with status 1 if any result disagrees with the reference.
+ */
+#include "cli_args.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+
+#define RANDOM_ITERATIONS 100000
+#define DOMAIN            200
+#define SPEC_MAX          4096
+
+static uint64_t rng_state = 88172645463325252ULL;
+static long failures = 0;
+
+/**
+ * @brief Returns the next value of a xorshift64 generator (deterministic across runs).
+ */
+static uint64_t next_random(void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return rng_state;
+}
+
+/**
+ * @brief Records a failure with the offending specification.
+ */
+static void fail(const char *what, const char *spec)
+{
+    if (failures++ < 10) {
+        printf("%s: \"%.200s\"\n", what, spec);
+    }
+}
+
+/**
+ * @brief Counts the maximal runs of set values in a bitmap, i.e. the merged intervals.
+ */
+static size_t count_runs(const unsigned char *member, int lo, int hi)
+{
+    size_t runs = 0;
+    for (int v = lo; v <= hi; v++) {
+        if (member[v - lo] && ((v == lo) || !member[v - lo - 1])) {
+            runs++;
+        }
+    }
+    return runs;
+}
+
+int main(void)
+{
+    char spec[SPEC_MAX];
+    char text[32];
+    interval_set_t set;
+
+    /* Listing more entries than the cap is fine as long as they merge. */
+    size_t n = 0;
+    for (int v = 0; v <= CLIPAR_INTERVAL_SET_MAX; v++) {
+        n += (size_t)sprintf(spec + n, "%s%d", (v == 0) ? "" : ",", v);
+    }
+    if (!interval_set_compile(spec, false, &set) || (set.count != 1)) {
+        fail("adjacent values did not merge", spec);
+    }
+    n = 0;
+    for (int v = 0; v <= CLIPAR_INTERVAL_SET_MAX; v++) {
+        n += (size_t)sprintf(spec + n, "%s%d", (v == 0) ? "" : ",", 2 * v);
+    }
+    if (interval_set_compile(spec, false, &set)) {
+        fail("more disjoint intervals than CLIPAR_INTERVAL_SET_MAX accepted", spec);
+    }
+    if (!interval_set_compile("0-18446744073709551615,5,0x10-0x20", false, &set) || (set.count != 1)) {
+        fail("full range did not absorb later entries", "0-18446744073709551615,5,0x10-0x20");
+    }
+
+    /* Random specifications; signed ones are shifted to straddle zero. */
+    static unsigned char member[DOMAIN];
+    long compiled = 0;
+    for (long it = 0; it < RANDOM_ITERATIONS; it++) {
+        int is_signed = (int)(next_random() & 1u);
+        int shift = is_signed ? (DOMAIN / 2) : 0;
+        int entries = 1 + (int)(next_random() % 60);
+        memset(member, 0, sizeof(member));
+        n = 0;
+        for (int e = 0; e < entries; e++) {
+            int lo = (int)(next_random() % DOMAIN);
+            int hi = lo + (((next_random() % 3) == 0) ? (int)(next_random() % 12) : 0);
+            hi = (hi >= DOMAIN) ? (DOMAIN - 1) : hi;
+            for (int v = lo; v <= hi; v++) {
+                member[v] = 1;
+            }
+            n += (size_t)sprintf(spec + n, "%s%d", (e == 0) ? "" : ",", lo - shift);
+            if (hi != lo) {
+                n += (size_t)sprintf(spec + n, "-%d", hi - shift);
+            }
+        }
+
+        size_t runs = count_runs(member, 0, DOMAIN - 1);
+        int ok = interval_set_compile(spec, is_signed != 0, &set) ? 1 : 0;
+        if (ok != (runs <= CLIPAR_INTERVAL_SET_MAX)) {
+            fail(ok ? "over-long set accepted" : "mergeable set rejected", spec);
+            continue;
+        }
+        if (!ok) {
+            continue;
+        }
+        compiled++;
+        if (set.count != runs) {
+            fail("intervals not fully merged", spec);
+        }
+        for (int v = -1; v <= DOMAIN; v++) {
+            int want = (v >= 0) && (v < DOMAIN) && member[v];
+            int got;
+            sprintf(text, "%d", v - shift);
+            if (is_signed) {
+                CLIPAR_INT value = 0;
+                got = parse_int_in_set(text, &set, &value) ? 1 : 0;
+            } else {
+                CLIPAR_UINT32 value = 0;
+                got = parse_uint32_in_set(text, &set, &value) ? 1 : 0;
+            }
+            if (got != want) {
+                fail(want ? "member rejected" : "non-member accepted", spec);
+                break;
+            }
+        }
+    }
+
+    printf("interval set check: %d specifications (%ld compiled), %ld mismatches\n", RANDOM_ITERATIONS, compiled,
+           failures);
+    return (failures == 0) ? 0 : 1;
+}
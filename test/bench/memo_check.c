@@ -0,0 +1,178 @@
+/**
+ * @file memo_check.c
+ * @brief Reference check and benchmark for parse_memoized().
+ *
+ * Feeds a random stream of repeated and new arguments through parse_memoized() with
+ * several parsers, including ones with large values (range lists, interval sets, glob
+ * patterns), and checks every result against calling the parser directly, across many
+ * cache resets. A repeated range list must be answered from the cache without calling the
+ * parser again. Finally times a cache hit against a direct range-list parse.
+ *
+ * Build and run from the repository root; the second build uses the smallest table:
+ *   cc -O2 -std=c99 -Iresources test/bench/memo_check.c resources/cli_args.c -o memo_check
+ *   cc -O2 -std=c99 -DCLIPAR_MEMO_SLOTS=4 -Iresources test/bench/memo_check.c resources/cli_args.c -o memo_check
+ *   ./memo_check
+ *
+ * Exits with status 1 if any result disagrees with the reference.
+ */
+#define _POSIX_C_SOURCE 199309L
+
+#include "cli_args.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+
+#define CHECK_ITERATIONS 1000000
+#define BENCH_ITERATIONS 1000000
+
+static uint64_t rng_state = 88172645463325252ULL;
+static long failures = 0;
+static long parser_calls = 0;
+
+/**
+ * @brief Returns the next value of a xorshift64 generator (deterministic across runs).
+ */
+static uint64_t next_random(void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return rng_state;
+}
+
+/**
+ * @brief Returns the current monotonic time in nanoseconds.
+ */
+static double now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((double)ts.tv_sec * 1e9) + (double)ts.tv_nsec;
+}
+
+/**
+ * @brief VLAN ID parser (small value).
+ */
+static CLIPAR_BOOL vlan_parser(const CLIPAR_CHAR *arg, void *out)
+{
+    parser_calls++;
+    return parse_uint32_in_range(arg, 1, 4094, (CLIPAR_UINT32 *)out);
+}
+
+/**
+ * @brief Bracket range list parser (large value).
+ */
+static CLIPAR_BOOL range_parser(const CLIPAR_CHAR *arg, void *out)
+{
+    parser_calls++;
+    return parse_range_expansion(arg, (range_expansion_t *)out);
+}
+
+/**
+ * @brief Unsigned interval set parser (large value).
+ */
+static CLIPAR_BOOL set_parser(const CLIPAR_CHAR *arg, void *out)
+{
+    parser_calls++;
+    return interval_set_compile(arg, false, (interval_set_t *)out);
+}
+
+/**
+ * @brief Glob pattern parser (large value).
+ */
+static CLIPAR_BOOL glob_parser(const CLIPAR_CHAR *arg, void *out)
+{
+    parser_calls++;
+    return parse_glob(arg, (glob_pattern_t *)out);
+}
+
+/**
+ * @brief A parser, the size of its value and a generator of mostly valid arguments.
+ */
+typedef struct {
+    custom_parser_t parser;
+    size_t size;
+    const char *format;
+} memo_kind_t;
+
+static const memo_kind_t kinds[] = {
+    { vlan_parser, sizeof(CLIPAR_UINT32), "%u" },
+    { range_parser, sizeof(range_expansion_t), "eth[0-%u]" },
+    { set_parser, sizeof(interval_set_t), "1-%u,5000" },
+    { glob_parser, sizeof(glob_pattern_t), "Gi%u/*" },
+};
+
+int main(void)
+{
+    static memo_cache_t cache;
+    static union {
+        CLIPAR_UINT32 vlan;
+        range_expansion_t range;
+        interval_set_t set;
+        glob_pattern_t glob;
+    } got, want;
+    char arg[64];
+
+    /* A repeated range list is a hit: one parser call, one hit, same value. */
+    memo_cache_init(&cache);
+    parser_calls = 0;
+    range_expansion_t first;
+    range_expansion_t second;
+    memset(&first, 0, sizeof(first));
+    memset(&second, 0xA5, sizeof(second));
+    if (!parse_memoized(&cache, "Gi0/[1-24,48]", range_parser, 7, &first, sizeof(first)) ||
+        !parse_memoized(&cache, "Gi0/[1-24,48]", range_parser, 7, &second, sizeof(second)) || (parser_calls != 1) ||
+        (cache.hits != 1) || (memcmp(&first, &second, sizeof(first)) != 0) || (range_expansion_count(&second) != 25)) {
+        failures++;
+        printf("range list was not served from the cache (calls %ld, hits %llu)\n", parser_calls,
+               (unsigned long long)cache.hits);
+    }
+
+    /* Random stream: mostly a small working set per kind, sometimes a new argument (invalid
+     * ones included), so both hits and table/arena resets occur. */
+    memo_cache_init(&cache);
+    parser_calls = 0;
+    for (long it = 0; it < CHECK_ITERATIONS; it++) {
+        size_t kind = (size_t)(next_random() % (sizeof(kinds) / sizeof(kinds[0])));
+        unsigned n = (unsigned)(next_random() % (((next_random() % 10) == 0) ? 1000 : 25));
+        CLIPAR_UINT32 spec_id = (CLIPAR_UINT32)(next_random() % 2);
+        snprintf(arg, sizeof(arg), kinds[kind].format, (n == 0) ? 5000u : n);
+        /* Both start zeroed, so a byte-wise comparison also covers struct padding. */
+        memset(&got, 0, sizeof(got));
+        memset(&want, 0, sizeof(want));
+
+        long calls_before = parser_calls;
+        int ok = parse_memoized(&cache, arg, kinds[kind].parser, spec_id, &got, kinds[kind].size) ? 1 : 0;
+        long calls_made = parser_calls - calls_before;
+        int want_ok = kinds[kind].parser(arg, &want) ? 1 : 0;
+        parser_calls--;
+        if ((ok != want_ok) || (ok && (memcmp(&got, &want, kinds[kind].size) != 0)) || (calls_made > 1)) {
+            if (failures++ < 10) {
+                printf("parse_memoized(\"%s\", kind %zu) = %d, direct parse = %d\n", arg, kind, ok, want_ok);
+            }
+        }
+    }
+    printf("reference check: %d calls, %ld parser calls, hit rate %.3f, %ld mismatches\n", CHECK_ITERATIONS,
+           parser_calls, (double)memo_cache_hit_rate(&cache), failures);
+
+    /* Hit cost for a large value against parsing it again. */
+    volatile unsigned long long sink = 0;
+    double t0 = now_ns();
+    for (int i = 0; i < BENCH_ITERATIONS; i++) {
+        parse_memoized(&cache, "Gi0/[1-24,48]", range_parser, 7, &first, sizeof(first));
+        sink += range_expansion_count(&first);
+    }
+    double hit_ns = (now_ns() - t0) / BENCH_ITERATIONS;
+
+    t0 = now_ns();
+    for (int i = 0; i < BENCH_ITERATIONS; i++) {
+        parse_range_expansion("Gi0/[1-24,48]", &first);
+        sink += range_expansion_count(&first);
+    }
+    double parse_ns = (now_ns() - t0) / BENCH_ITERATIONS;
+
+    printf("range list (%zu-byte value): memo hit %.1f ns, direct parse %.1f ns\n", sizeof(range_expansion_t), hit_ns,
+           parse_ns);
+    return (failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,155 @@
+/**
+ * @file option_bench.c
+ * @brief Reference check and benchmark for parse_string_option() with many option tables.
+ *
+ * Compares parse_string_option() with a first-match linear scan on random lookups spread
+ * over up to 256 live tables of 8 to 128 options (with duplicates and misses), so table
+ * indexes are built, shared between colliding tables and replaced. Then times lookups that
+ * cycle through 1, 4, 16, 64 and 256 tables of 16 options against the plain linear scan.
+ *
+ * Build and run from the repository root (add -DCLIPAR_NO_OPTION_CACHE for the baseline):
+ *   cc -O2 -std=c99 -Iresources test/bench/option_bench.c resources/cli_args.c -o option_bench
+ *   ./option_bench
+ *
+ * Exits with status 1 if any result disagrees with the reference.
+ */
+#define _POSIX_C_SOURCE 199309L
+
+#include "cli_args.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+
+#define MAX_TABLES       256
+#define MAX_OPTIONS      128
+#define CHECK_ITERATIONS 2000000
+#define BENCH_ITERATIONS 2000000
+#define BENCH_OPTIONS    16
+
+static uint64_t rng_state = 88172645463325252ULL;
+static long failures = 0;
+
+static const char *tables[MAX_TABLES][MAX_OPTIONS];
+static size_t table_sizes[MAX_TABLES];
+static char words[MAX_TABLES * MAX_OPTIONS][16];
+
+/**
+ * @brief Returns the next value of a xorshift64 generator (deterministic across runs).
+ */
+static uint64_t next_random(void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return rng_state;
+}
+
+/**
+ * @brief Returns the current monotonic time in nanoseconds.
+ */
+static double now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((double)ts.tv_sec * 1e9) + (double)ts.tv_nsec;
+}
+
+/**
+ * @brief Reference lookup: index of the first equal option, or -1.
+ */
+static long linear_find(const char *arg, const char *const *options, size_t n)
+{
+    for (size_t i = 0; i < n; i++) {
+        if (strcmp(arg, options[i]) == 0) {
+            return (long)i;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief Fills word w with a short keyword drawn from a small alphabet, so words collide often.
+ */
+static void make_word(char *w)
+{
+    size_t len = 1 + (size_t)(next_random() % 8);
+    for (size_t i = 0; i < len; i++) {
+        w[i] = "abcdefgh-"[next_random() % 9];
+    }
+    w[len] = '\0';
+}
+
+/**
+ * @brief Times round-robin lookups over the first count tables (BENCH_OPTIONS options each).
+ */
+static void bench_tables(size_t count)
+{
+    volatile unsigned long sink = 0;
+    CLIPAR_UINT index = 0;
+
+    double t0 = now_ns();
+    for (long i = 0; i < BENCH_ITERATIONS; i++) {
+        size_t t = (size_t)i % count;
+        parse_string_option(tables[t][(i * 7) % BENCH_OPTIONS], tables[t], BENCH_OPTIONS, &index);
+        sink += index;
+    }
+    double option_ns = (now_ns() - t0) / BENCH_ITERATIONS;
+
+    t0 = now_ns();
+    for (long i = 0; i < BENCH_ITERATIONS; i++) {
+        size_t t = (size_t)i % count;
+        sink += (unsigned long)linear_find(tables[t][(i * 7) % BENCH_OPTIONS], tables[t], BENCH_OPTIONS);
+    }
+    double linear_ns = (now_ns() - t0) / BENCH_ITERATIONS;
+
+    printf("%3zu tables of %d options: parse_string_option %5.1f ns, linear scan %5.1f ns\n", count, BENCH_OPTIONS,
+           option_ns, linear_ns);
+}
+
+int main(void)
+{
+    /* Random tables; duplicates within a table are allowed and must resolve to the first. */
+    size_t next_word = 0;
+    for (size_t t = 0; t < MAX_TABLES; t++) {
+        table_sizes[t] = 8 + (size_t)(next_random() % (MAX_OPTIONS - 7));
+        for (size_t i = 0; i < table_sizes[t]; i++) {
+            make_word(words[next_word]);
+            tables[t][i] = words[next_word++];
+        }
+    }
+
+    char arg[16];
+    for (long it = 0; it < CHECK_ITERATIONS; it++) {
+        /* Bursts on a few tables mixed with uniform traffic over all of them. */
+        size_t live = ((it / 50000) % 2 == 0) ? 6 : MAX_TABLES;
+        size_t t = (size_t)(next_random() % live);
+        if ((next_random() % 4) == 0) {
+            make_word(arg);
+        } else {
+            strcpy(arg, tables[t][next_random() % table_sizes[t]]);
+        }
+        CLIPAR_UINT index = 0;
+        long want = linear_find(arg, tables[t], table_sizes[t]);
+        int ok = parse_string_option(arg, tables[t], table_sizes[t], &index) ? 1 : 0;
+        if ((ok != (want >= 0)) || (ok && ((long)index != want))) {
+            if (failures++ < 10) {
+                printf("parse_string_option(\"%s\", table %zu) = %d, %u; expected %ld\n", arg, t, ok, index, want);
+            }
+        }
+    }
+    printf("reference check: %d lookups over %d tables, %ld mismatches\n", CHECK_ITERATIONS, MAX_TABLES, failures);
+
+    /* Distinct words for the timing tables, so every lookup succeeds at a known position. */
+    for (size_t t = 0; t < MAX_TABLES; t++) {
+        for (size_t i = 0; i < BENCH_OPTIONS; i++) {
+            sprintf(words[(t * MAX_OPTIONS) + i], "opt%zu-%zu", t, i * 37);
+            tables[t][i] = words[(t * MAX_OPTIONS) + i];
+        }
+    }
+    static const size_t counts[] = { 1, 4, 16, 64, 256 };
+    for (size_t i = 0; i < (sizeof(counts) / sizeof(counts[0])); i++) {
+        bench_tables(counts[i]);
+    }
+    return (failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,339 @@
+/**
+ * @file range_bench.c
+ * @brief Reference check and benchmark for parse_range_expansion() and its batch reader.
+ *
+ * Builds random arguments of the form prefix[spec]suffix, with stray or missing brackets,
+ * malformed entries, leading zeros and over-long parts mixed in, and compares the result
+ * with a straightforward reference: exactly one '[' followed by one ']', comma-separated
+ * decimal "value" or "lo-hi" entries, a bitmap of the listed values and sprintf() for the
+ * items. Values are read back through range_expansion_next() with random batch sizes.
+ * Then times expanding "eth[0-47]" in one batch against parsing 48 expanded arguments.
+ *
+ * Build and run from the repository root:
+ *   cc -O2 -std=c99 -Iresources test/bench/range_bench.c resources/cli_args.c -o range_bench
+ *   ./range_bench
+ *
+ * Exits with status 1 if any result disagrees with the reference.
+ */
+#define _POSIX_C_SOURCE 199309L
+
+#include "cli_args.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+
+#define CHECK_ITERATIONS 300000
+#define BENCH_ITERATIONS 200000
+#define DOMAIN           1000
+
+static uint64_t rng_state = 88172645463325252ULL;
+static long failures = 0;
+
+/**
+ * @brief Returns the next value of a xorshift64 generator (deterministic across runs).
+ */
+static uint64_t next_random(void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return rng_state;
+}
+
+/**
+ * @brief Returns the current monotonic time in nanoseconds.
+ */
+static double now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((double)ts.tv_sec * 1e9) + (double)ts.tv_nsec;
+}
+
+/**
+ * @brief Records a failure with the offending argument.
+ */
+static void fail(const char *what, const char *arg)
+{
+    if (failures++ < 10) {
+        printf("%s: \"%s\"\n", what, arg);
+    }
+}
+
+/**
+ * @brief Reference parse of one decimal bound; tracks the longest bound and zero padding.
+ */
+static int reference_bound(const char **pp, unsigned long long *value, size_t *longest, int *padded)
+{
+    const char *p = *pp;
+    size_t digits = 0;
+    *value = 0;
+    while ((*p >= '0') && (*p <= '9')) {
+        unsigned d = (unsigned)(*p - '0');
+        if (*value > ((UINT64_MAX - d) / 10)) {
+            return 0;
+        }
+        *value = (*value * 10) + d;
+        digits++;
+        p++;
+    }
+    if (digits == 0) {
+        return 0;
+    }
+    if ((digits > 1) && (**pp == '0')) {
+        *padded = 1;
+    }
+    *longest = (digits > *longest) ? digits : *longest;
+    *pp = p;
+    return 1;
+}
+
+/**
+ * @brief Reference parser: fills member (values below DOMAIN) and width; returns 0 if invalid.
+ */
+static int reference_parse(const char *arg, unsigned char *member, unsigned *width, char *prefix, char *suffix)
+{
+    const char *open = NULL;
+    const char *close = NULL;
+    for (const char *p = arg; *p != '\0'; p++) {
+        if (*p == '[') {
+            if ((open != NULL) || (close != NULL)) {
+                return 0;
+            }
+            open = p;
+        } else if (*p == ']') {
+            if ((open == NULL) || (close != NULL)) {
+                return 0;
+            }
+            close = p;
+        }
+    }
+    if ((close == NULL) || ((size_t)(open - arg) >= CLIPAR_RANGE_AFFIX_MAX) ||
+        (strlen(close + 1) >= CLIPAR_RANGE_AFFIX_MAX) || ((size_t)(close - open - 1) >= CLIPAR_RANGE_SPEC_MAX)) {
+        return 0;
+    }
+
+    memset(member, 0, DOMAIN);
+    size_t longest = 0;
+    int padded = 0;
+    const char *p = open + 1;
+    for (;;) {
+        unsigned long long lo;
+        unsigned long long hi;
+        if (!reference_bound(&p, &lo, &longest, &padded)) {
+            return 0;
+        }
+        hi = lo;
+        if (*p == '-') {
+            p++;
+            if (!reference_bound(&p, &hi, &longest, &padded) || (hi < lo)) {
+                return 0;
+            }
+        }
+        for (unsigned long long v = lo; (v <= hi) && (v < DOMAIN); v++) {
+            member[v] = 1;
+        }
+        if (*p == ']') {
+            break;
+        }
+        if (*p != ',') {
+            return 0;
+        }
+        p++;
+    }
+
+    size_t runs = 0;
+    for (int v = 0; v < DOMAIN; v++) {
+        runs += (member[v] && ((v == 0) || !member[v - 1])) ? 1 : 0;
+    }
+    *width = padded ? (unsigned)longest : 0;
+    if ((runs > CLIPAR_INTERVAL_SET_MAX) || (*width >= CLIPAR_UINT64_STRLEN)) {
+        return 0;
+    }
+    memcpy(prefix, arg, (size_t)(open - arg));
+    prefix[open - arg] = '\0';
+    strcpy(suffix, close + 1);
+    return 1;
+}
+
+/**
+ * @brief Appends a random affix (sometimes long, sometimes with a stray bracket) at *n.
+ */
+static void append_affix(char *arg, size_t *n)
+{
+    static const char alphabet[] = "ethGi/0-.:x";
+    size_t len = (size_t)(next_random() % (((next_random() % 20) == 0) ? 40 : 8));
+    for (size_t i = 0; i < len; i++) {
+        arg[(*n)++] = ((next_random() % 200) == 0) ? "[]"[next_random() % 2] : alphabet[next_random() % (sizeof(alphabet) - 1)];
+    }
+}
+
+/**
+ * @brief Appends a random decimal bound, sometimes with leading zeros, at *n.
+ */
+static void append_bound(char *arg, size_t *n, unsigned value)
+{
+    int zeros = ((next_random() % 6) == 0) ? (int)(next_random() % 3) : 0;
+    *n += (size_t)sprintf(arg + *n, "%.*s%u", zeros, "00", value);
+}
+
+/**
+ * @brief Builds a random prefix[spec]suffix argument, occasionally malformed.
+ */
+static void make_argument(char *arg)
+{
+    size_t n = 0;
+    append_affix(arg, &n);
+    if ((next_random() % 50) != 0) {
+        arg[n++] = '[';
+    }
+    int entries = 1 + (int)(next_random() % (((next_random() % 10) == 0) ? 40 : 6));
+    for (int e = 0; e < entries; e++) {
+        if (e != 0) {
+            arg[n++] = ',';
+        }
+        unsigned lo = (unsigned)(next_random() % DOMAIN);
+        append_bound(arg, &n, lo);
+        if ((next_random() % 3) == 0) {
+            arg[n++] = '-';
+            unsigned hi = lo + (unsigned)(next_random() % 40);
+            hi = ((next_random() % 30) == 0) ? (unsigned)(next_random() % DOMAIN) : hi;
+            append_bound(arg, &n, (hi >= DOMAIN) ? (DOMAIN - 1) : hi);
+        }
+        if ((next_random() % 150) == 0) {
+            arg[n++] = ",-x "[next_random() % 4];
+        }
+    }
+    if ((next_random() % 50) != 0) {
+        arg[n++] = ']';
+    }
+    append_affix(arg, &n);
+    arg[n] = '\0';
+}
+
+/**
+ * @brief Compares one argument with the reference, reading values in random batch sizes.
+ */
+static int check_argument(const char *arg)
+{
+    static unsigned char member[DOMAIN];
+    char prefix[256];
+    char suffix[256];
+    char want[320];
+    char got[320];
+    unsigned width = 0;
+    range_expansion_t range;
+
+    int valid = reference_parse(arg, member, &width, prefix, suffix);
+    if (valid != (parse_range_expansion(arg, &range) ? 1 : 0)) {
+        fail(valid ? "valid argument rejected" : "invalid argument accepted", arg);
+        return 0;
+    }
+    if (!valid) {
+        return 0;
+    }
+
+    unsigned long long expected = 0;
+    for (int v = 0; v < DOMAIN; v++) {
+        expected += member[v];
+    }
+    if (range_expansion_count(&range) != expected) {
+        fail("range_expansion_count differs", arg);
+        return 1;
+    }
+
+    range_cursor_t cur;
+    CLIPAR_UINT64 batch[8];
+    CLIPAR_SIZE_T got_n;
+    int v = 0;
+    range_cursor_init(&range, &cur);
+    while ((got_n = range_expansion_next(&range, &cur, batch, 1 + (CLIPAR_SIZE_T)(next_random() % 8))) != 0) {
+        for (CLIPAR_SIZE_T i = 0; i < got_n; i++) {
+            while ((v < DOMAIN) && !member[v]) {
+                v++;
+            }
+            if ((v == DOMAIN) || (batch[i] != (CLIPAR_UINT64)v)) {
+                fail("range_expansion_next produced a wrong value", arg);
+                return 1;
+            }
+            int len = sprintf(want, "%s%0*d%s", prefix, (int)width, v, suffix);
+            if ((format_range_item(&range, batch[i], got, (CLIPAR_SIZE_T)len + 1) != (CLIPAR_SIZE_T)len) ||
+                (strcmp(got, want) != 0) || (format_range_item(&range, batch[i], got, (CLIPAR_SIZE_T)len) != 0)) {
+                fail("format_range_item differs", arg);
+                return 1;
+            }
+            v++;
+        }
+    }
+    while ((v < DOMAIN) && !member[v]) {
+        v++;
+    }
+    if (v != DOMAIN) {
+        fail("range_expansion_next stopped early", arg);
+    }
+    return 1;
+}
+
+int main(void)
+{
+    static const char *const invalid[] = { "eth", "eth[]", "eth[0-47", "eth0-47]", "x[1-2]]", "x[1-2][3]", "a]b[1]",
+                                           "x[a-b]", "x[1-]", "x[-1]", "x[3-1]", "x[1,,2]", "x[1,]", "x[0x10]",
+                                           "x[ 1]", "x[18446744073709551616]", "x[000000000000000000001]" };
+    for (size_t i = 0; i < (sizeof(invalid) / sizeof(invalid[0])); i++) {
+        range_expansion_t range;
+        if (parse_range_expansion(invalid[i], &range)) {
+            fail("invalid argument accepted", invalid[i]);
+        }
+    }
+
+    /* Bounds outside the reference domain: largest value, widest padding. */
+    range_expansion_t range;
+    char text[64];
+    if (!parse_range_expansion("n[18446744073709551614-18446744073709551615]/x", &range) ||
+        (range_expansion_count(&range) != 2) || (format_range_item(&range, UINT64_MAX, text, sizeof(text)) == 0) ||
+        (strcmp(text, "n18446744073709551615/x") != 0)) {
+        fail("largest values not expanded", "n[18446744073709551614-18446744073709551615]/x");
+    }
+    if (!parse_range_expansion("p[00000000000000000007]", &range) || (range.width != 20) ||
+        (format_range_item(&range, 7, text, sizeof(text)) == 0) || (strcmp(text, "p00000000000000000007") != 0)) {
+        fail("20-digit padding not kept", "p[00000000000000000007]");
+    }
+
+    char arg[512];
+    long valid = 0;
+    for (long it = 0; it < CHECK_ITERATIONS; it++) {
+        make_argument(arg);
+        valid += check_argument(arg);
+    }
+    printf("reference check: %d arguments (%ld valid), %ld mismatches\n", CHECK_ITERATIONS, valid, failures);
+
+    /* One parse and one batch against parsing every expanded argument. */
+    volatile unsigned long long sink = 0;
+    CLIPAR_UINT64 batch[64];
+    double t0 = now_ns();
+    for (int r = 0; r < BENCH_ITERATIONS; r++) {
+        range_cursor_t cur;
+        parse_range_expansion("eth[0-47]", &range);
+        range_cursor_init(&range, &cur);
+        CLIPAR_SIZE_T n = range_expansion_next(&range, &cur, batch, 64);
+        for (CLIPAR_SIZE_T i = 0; i < n; i++) {
+            sink += batch[i];
+        }
+    }
+    double batch_ns = (now_ns() - t0) / BENCH_ITERATIONS;
+
+    t0 = now_ns();
+    for (int r = 0; r < BENCH_ITERATIONS; r++) {
+        for (int i = 0; i < 48; i++) {
+            CLIPAR_UINT32 value = 0;
+            sprintf(text, "eth%d", i);
+            parse_uint32_in_range(text + 3, 0, 47, &value);
+            sink += value;
+        }
+    }
+    double textual_ns = (now_ns() - t0) / BENCH_ITERATIONS;
+
+    printf("eth[0-47]: batch expansion %.0f ns, 48 expanded arguments %.0f ns\n", batch_ns, textual_ns);
+    return (failures == 0) ? 0 : 1;
+}
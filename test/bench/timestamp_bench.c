@@ -0,0 +1,155 @@
+/**
+ * @file timestamp_bench.c
+ * @brief Reference check and benchmark for parse_timestamp().
+ *
+ * Compares parse_timestamp() with strptime() + timegm() on random timestamps across the
+ * whole representable range, checks the exact int64 nanosecond limits and a set of
+ * malformed inputs, then times both on the same RFC 3339 string. Requires a libc with
+ * strptime() and timegm() (glibc, musl, the BSDs).
+ *
+ * The original target was 10x over strptime() + timegm(). On the x86-64 VM used for
+ * development (GCC 12, -O2, glibc 2.36) the best of five runs is about 32 ns against
+ * 185-205 ns, i.e. 6x; before the days_from_civil() and fraction rewrite it was about
+ * 45 ns (4.5x). The remaining hot path is roughly 170 straight-line instructions plus
+ * the strlen() call that bounds the 8-byte loads, which alone costs about 5 ns there
+ * (printed below for reference). Dropping strlen() would mean reading past the
+ * terminator, so the gap is accepted; the ratio is printed rather than asserted.
+ *
+ * Build and run from the repository root:
+ *   cc -O2 -std=c99 -Iresources test/bench/timestamp_bench.c resources/cli_args.c -o timestamp_bench
+ *   ./timestamp_bench
+ *
+ * Exits with status 1 if any result disagrees with the reference.
+ */
+#define _GNU_SOURCE
+
+#include "cli_args.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+
+#define CHECK_ITERATIONS 1000000
+#define BENCH_ITERATIONS 5000000
+
+static uint64_t rng_state = 88172645463325252ULL;
+static long failures = 0;
+
+/**
+ * @brief Returns the next value of a xorshift64 generator (deterministic across runs).
+ */
+static uint64_t next_random(void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return rng_state;
+}
+
+/**
+ * @brief Returns the current monotonic time in nanoseconds.
+ */
+static double now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((double)ts.tv_sec * 1e9) + (double)ts.tv_nsec;
+}
+
+/**
+ * @brief Records a failure if parse_timestamp() does not give the expected result.
+ */
+static void expect(const char *arg, int valid, int64_t want)
+{
+    CLIPAR_INT64 got = 0;
+    int ok = parse_timestamp(arg, &got) ? 1 : 0;
+    if ((ok != valid) || (valid && (got != want))) {
+        if (failures++ < 10) {
+            printf("parse_timestamp(\"%s\") = %d, %lld; expected %d, %lld\n", arg, ok, (long long)got, valid,
+                   (long long)want);
+        }
+    }
+}
+
+int main(void)
+{
+    char text[64];
+
+    /* Random timestamps between 1678 and 2261 with random fractions and offsets. */
+    for (long i = 0; i < CHECK_ITERATIONS; i++) {
+        struct tm tm;
+        memset(&tm, 0, sizeof(tm));
+        int year = 1678 + (int)(next_random() % 584);
+        tm.tm_year = year - 1900;
+        tm.tm_mon = (int)(next_random() % 12);
+        tm.tm_mday = 1 + (int)(next_random() % 31);
+        tm.tm_hour = (int)(next_random() % 24);
+        tm.tm_min = (int)(next_random() % 60);
+        tm.tm_sec = (int)(next_random() % 60);
+        struct tm norm = tm;
+        int64_t secs = (int64_t)timegm(&norm);
+        if (norm.tm_mday != tm.tm_mday) {
+            continue; /* Day does not exist in this month. */
+        }
+        long frac = (long)(next_random() % 1000000000u);
+        int off = (int)(next_random() % (24 * 60)) - (12 * 60);
+        snprintf(text, sizeof(text), "%04d-%02d-%02dT%02d:%02d:%02d.%09ld%c%02d:%02d", year, tm.tm_mon + 1,
+                 tm.tm_mday, tm.tm_hour, tm.tm_min, tm.tm_sec, frac, (off < 0) ? '-' : '+', (off < 0 ? -off : off) / 60,
+                 (off < 0 ? -off : off) % 60);
+        expect(text, 1, ((secs - ((int64_t)off * 60)) * 1000000000LL) + frac);
+    }
+
+    /* Exact limits of int64 nanoseconds. */
+    expect("2262-04-11T23:47:16.854775807Z", 1, INT64_MAX);
+    expect("2262-04-11T23:47:16.854775808Z", 0, 0);
+    expect("1677-09-21T00:12:43.145224192Z", 1, INT64_MIN);
+    expect("1677-09-21T00:12:43.999999999Z", 1, INT64_MIN + 854775807LL);
+    expect("1677-09-21T00:12:43.145224191Z", 0, 0);
+    expect("1677-09-21T00:12:42Z", 0, 0);
+
+    /* Other accepted forms. */
+    expect("1970-01-01T00:00:00Z", 1, 0);
+    expect("1969-12-31t23:59:59.5z", 1, -500000000LL);
+    expect("2024-02-29 14:34:56.123456789123+02:00", 1, 1709210096123456789LL);
+
+    static const char *const bad[] = {
+        "2026-02-29T00:00:00Z", "2026-13-01T00:00:00Z", "2026-10-16T24:00:00Z", "2026-10-16T12:34:60Z",
+        "2026-10-16T12:34:56", "2026-10-16T12:34:56.Z", "2026-10-16X12:34:56Z", "2026/10-16T12:34:56Z",
+        "2026-10-16T12:34:56+0200", "2026-10-16T12:34:56Zx", "2026-10-16T12:3a:56Z", "2026-10-16T12:34:56+24:00"
+    };
+    for (size_t i = 0; i < (sizeof(bad) / sizeof(bad[0])); i++) {
+        expect(bad[i], 0, 0);
+    }
+    printf("reference check: %d timestamps, %ld mismatches\n", CHECK_ITERATIONS, failures);
+
+    const char *sample = "2026-10-16T12:34:56.789Z";
+    volatile int64_t sink = 0;
+    CLIPAR_INT64 ns = 0;
+
+    double t0 = now_ns();
+    for (int i = 0; i < BENCH_ITERATIONS; i++) {
+        parse_timestamp(sample, &ns);
+        sink += ns;
+    }
+    double parse_ns = (now_ns() - t0) / BENCH_ITERATIONS;
+
+    t0 = now_ns();
+    for (int i = 0; i < BENCH_ITERATIONS; i++) {
+        struct tm tm;
+        memset(&tm, 0, sizeof(tm));
+        strptime(sample, "%Y-%m-%dT%H:%M:%S", &tm);
+        sink += (int64_t)timegm(&tm);
+    }
+    double libc_ns = (now_ns() - t0) / BENCH_ITERATIONS;
+
+    size_t (*volatile length)(const char *) = strlen;
+    t0 = now_ns();
+    for (int i = 0; i < BENCH_ITERATIONS; i++) {
+        sink += (int64_t)length(sample);
+    }
+    double strlen_ns = (now_ns() - t0) / BENCH_ITERATIONS;
+
+    printf("parse_timestamp %.1f ns/op, strptime+timegm %.1f ns/op (%.1fx), strlen alone %.1f ns/op\n", parse_ns,
+           libc_ns, libc_ns / parse_ns, strlen_ns);
+    return (failures == 0) ? 0 : 1;
+}
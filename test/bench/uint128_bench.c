@@ -0,0 +1,171 @@
+/**
+ * @file uint128_bench.c
+ * @brief Reference check and benchmark for parse_uint128_in_range() and format_uint128().
+ *
+ * Round-trips random 128-bit values through the library and compares them with the
+ * compiler's unsigned __int128, then times both functions against naive digit-at-a-time
+ * loops on the same type. Requires GCC or Clang on a 64-bit target.
+ *
+ * Build and run from the repository root:
+ *   cc -O2 -std=c99 -Iresources test/bench/uint128_bench.c resources/cli_args.c -o uint128_bench
+ *   ./uint128_bench
+ *
+ * Exits with status 1 if any value disagrees with the reference.
+ */
+#define _POSIX_C_SOURCE 199309L
+
+#include "cli_args.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+
+#define CHECK_ITERATIONS 300000
+#define BENCH_ITERATIONS 2000000
+
+__extension__ typedef unsigned __int128 u128;
+
+static uint64_t rng_state = 88172645463325252ULL;
+
+/**
+ * @brief Returns the next value of a xorshift64 generator (deterministic across runs).
+ */
+static uint64_t next_random(void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return rng_state;
+}
+
+/**
+ * @brief Returns a random 128-bit value with a random bit length, so all digit counts occur.
+ */
+static u128 random_u128(void)
+{
+    u128 v = ((u128)next_random() << 64) | next_random();
+    return v >> (next_random() % 128);
+}
+
+/**
+ * @brief Returns the current monotonic time in nanoseconds.
+ */
+static double now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((double)ts.tv_sec * 1e9) + (double)ts.tv_nsec;
+}
+
+/**
+ * @brief Naive reference formatter: one division by 10 per digit.
+ */
+static void naive_format(u128 v, char *buf)
+{
+    char tmp[48];
+    int n = 0;
+    do {
+        tmp[n++] = (char)('0' + (int)(v % 10));
+        v /= 10;
+    } while (v != 0);
+    for (int i = 0; i < n; i++) {
+        buf[i] = tmp[n - 1 - i];
+    }
+    buf[n] = '\0';
+}
+
+/**
+ * @brief Naive reference parser: one multiply-add with an overflow check per digit.
+ */
+static int naive_parse(const char *s, u128 *out)
+{
+    const u128 max = ~(u128)0;
+    u128 v = 0;
+    if (*s == '\0') {
+        return 0;
+    }
+    for (; *s != '\0'; s++) {
+        if ((*s < '0') || (*s > '9')) {
+            return 0;
+        }
+        unsigned d = (unsigned)(*s - '0');
+        if (v > ((max - d) / 10)) {
+            return 0;
+        }
+        v = (v * 10) + d;
+    }
+    *out = v;
+    return 1;
+}
+
+int main(void)
+{
+    const uint128_value_t min = { 0, 0 };
+    const uint128_value_t max = { UINT64_MAX, UINT64_MAX };
+    char expect[CLIPAR_UINT128_STRLEN];
+    char text[CLIPAR_UINT128_STRLEN];
+    uint128_value_t parsed;
+    long failures = 0;
+
+    for (int i = 0; i < CHECK_ITERATIONS; i++) {
+        u128 v = random_u128();
+        uint128_value_t value = { (uint64_t)(v >> 64), (uint64_t)v };
+        naive_format(v, expect);
+
+        if (!parse_uint128_in_range(expect, min, max, &parsed) || (parsed.hi != value.hi) || (parsed.lo != value.lo)) {
+            if (failures++ < 5) {
+                printf("parse mismatch: %s\n", expect);
+            }
+        }
+        if ((format_uint128(value, false, text, sizeof(text)) != strlen(expect)) || (strcmp(text, expect) != 0)) {
+            if (failures++ < 5) {
+                printf("format mismatch: %s vs %s\n", text, expect);
+            }
+        }
+        format_uint128(value, true, text, sizeof(text));
+        if (!parse_uint128_in_range(text, min, max, &parsed) || (parsed.hi != value.hi) || (parsed.lo != value.lo)) {
+            if (failures++ < 5) {
+                printf("hex round-trip mismatch: %s\n", text);
+            }
+        }
+    }
+    printf("reference check: %d values, %ld mismatches\n", CHECK_ITERATIONS, failures);
+
+    /* A 39-digit value near the top of the range exercises every limb. */
+    const char *digits = "170141183460469231731687303715884105727";
+    const uint128_value_t big = { UINT64_MAX >> 1, UINT64_MAX };
+    const u128 big_native = ((u128)big.hi << 64) | big.lo;
+    volatile uint64_t sink = 0;
+    u128 native = 0;
+
+    double t0 = now_ns();
+    for (int i = 0; i < BENCH_ITERATIONS; i++) {
+        parse_uint128_in_range(digits, min, max, &parsed);
+        sink += parsed.lo;
+    }
+    double parse_ns = (now_ns() - t0) / BENCH_ITERATIONS;
+
+    t0 = now_ns();
+    for (int i = 0; i < BENCH_ITERATIONS; i++) {
+        naive_parse(digits, &native);
+        sink += (uint64_t)native;
+    }
+    double naive_parse_ns = (now_ns() - t0) / BENCH_ITERATIONS;
+
+    t0 = now_ns();
+    for (int i = 0; i < BENCH_ITERATIONS; i++) {
+        sink += format_uint128(big, false, text, sizeof(text));
+    }
+    double format_ns = (now_ns() - t0) / BENCH_ITERATIONS;
+
+    t0 = now_ns();
+    for (int i = 0; i < BENCH_ITERATIONS; i++) {
+        naive_format(big_native, text);
+        sink += (uint64_t)text[3];
+    }
+    double naive_format_ns = (now_ns() - t0) / BENCH_ITERATIONS;
+
+    printf("parse  39 digits: %6.1f ns (naive loop %6.1f ns)\n", parse_ns, naive_parse_ns);
+    printf("format 39 digits: %6.1f ns (naive loop %6.1f ns)\n", format_ns, naive_format_ns);
+    return (failures == 0) ? 0 : 1;
+}
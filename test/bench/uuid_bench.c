@@ -0,0 +1,150 @@
+/**
+ * @file uuid_bench.c
+ * @brief Reference check and benchmark for parse_uuid() and parse_uuid_batch().
+ *
+ * Formats random 16-byte values with sprintf() in both letter cases and checks that
+ * parse_uuid() returns the same bytes, then corrupts one random character of each and
+ * checks that the result is rejected. Finally times parse_uuid() against sscanf().
+ *
+ * Build and run from the repository root, once per decoder:
+ *   cc -O2 -std=c99 -mssse3 -Iresources test/bench/uuid_bench.c resources/cli_args.c -o uuid_bench
+ *   cc -O2 -std=c99 -DCLIPAR_NO_SIMD -Iresources test/bench/uuid_bench.c resources/cli_args.c -o uuid_bench
+ *   ./uuid_bench
+ *
+ * Exits with status 1 if any result disagrees with the reference.
+ */
+#define _POSIX_C_SOURCE 199309L
+
+#include "cli_args.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+
+#define CHECK_ITERATIONS 1000000
+#define BENCH_ITERATIONS 5000000
+
+static uint64_t rng_state = 88172645463325252ULL;
+static long failures = 0;
+
+/**
+ * @brief Returns the next value of a xorshift64 generator (deterministic across runs).
+ */
+static uint64_t next_random(void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return rng_state;
+}
+
+/**
+ * @brief Returns the current monotonic time in nanoseconds.
+ */
+static double now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((double)ts.tv_sec * 1e9) + (double)ts.tv_nsec;
+}
+
+/**
+ * @brief Returns whether c may appear at position pos of an unbraced UUID.
+ */
+static int allowed_at(int pos, int c)
+{
+    if ((pos == 8) || (pos == 13) || (pos == 18) || (pos == 23)) {
+        return (c == '-');
+    }
+    return (c != '\0') && (strchr("0123456789abcdefABCDEF", c) != NULL);
+}
+
+int main(void)
+{
+    static const char *const formats[2] = {
+        "%02x%02x%02x%02x-%02x%02x-%02x%02x-%02x%02x-%02x%02x%02x%02x%02x%02x",
+        "%02X%02X%02X%02X-%02X%02X-%02X%02X-%02X%02X-%02X%02X%02X%02X%02X%02X"
+    };
+    char text[64];
+    CLIPAR_UINT8 out[16];
+
+    for (long it = 0; it < CHECK_ITERATIONS; it++) {
+        uint8_t r[16];
+        for (int i = 0; i < 16; i++) {
+            r[i] = (uint8_t)next_random();
+        }
+        sprintf(text, formats[it & 1], r[0], r[1], r[2], r[3], r[4], r[5], r[6], r[7], r[8], r[9], r[10], r[11],
+                r[12], r[13], r[14], r[15]);
+        if (!parse_uuid(text, out) || (memcmp(out, r, 16) != 0)) {
+            if (failures++ < 10) {
+                printf("parse_uuid(\"%s\") rejected or decoded wrongly\n", text);
+            }
+        }
+
+        /* Braced form must decode to the same bytes. */
+        char braced[72];
+        sprintf(braced, "{%s}", text);
+        if (!parse_uuid(braced, out) || (memcmp(out, r, 16) != 0)) {
+            if (failures++ < 10) {
+                printf("parse_uuid(\"%s\") rejected or decoded wrongly\n", braced);
+            }
+        }
+
+        /* Any single character outside the layout must be rejected. */
+        int pos = (int)(next_random() % 36);
+        int c;
+        do {
+            c = 1 + (int)(next_random() % 255);
+        } while (allowed_at(pos, c));
+        char save = text[pos];
+        text[pos] = (char)c;
+        if (parse_uuid(text, out)) {
+            if (failures++ < 10) {
+                printf("parse_uuid(\"%s\") accepted a corrupted UUID\n", text);
+            }
+        }
+        text[pos] = save;
+    }
+
+    static const char *const bad[] = {
+        "", "123e4567-e89b-12d3-a456-42661417400", "123e4567-e89b-12d3-a456-4266141740000",
+        "{123e4567-e89b-12d3-a456-426614174000", "123e4567-e89b-12d3-a456-426614174000}",
+        "(123e4567-e89b-12d3-a456-426614174000)", "123e4567e89b12d3a456426614174000"
+    };
+    for (size_t i = 0; i < (sizeof(bad) / sizeof(bad[0])); i++) {
+        if (parse_uuid(bad[i], out)) {
+            if (failures++ < 10) {
+                printf("parse_uuid(\"%s\") should be invalid\n", bad[i]);
+            }
+        }
+    }
+
+    const char *batch[3] = { "123e4567-e89b-12d3-a456-426614174000", "123e4567-e89b-12d3-a456-426614174001", "x" };
+    CLIPAR_UINT8 batch_out[3][16];
+    if ((parse_uuid_batch(batch, 3, batch_out) != 2) || (batch_out[1][15] != 0x01)) {
+        failures++;
+        printf("parse_uuid_batch() did not stop at the first invalid entry\n");
+    }
+    printf("reference check: %d UUIDs, %ld mismatches\n", CHECK_ITERATIONS, failures);
+
+    const char *sample = "123e4567-e89b-12d3-a456-426614174000";
+    volatile unsigned sink = 0;
+
+    double t0 = now_ns();
+    for (int i = 0; i < BENCH_ITERATIONS; i++) {
+        sink += parse_uuid(sample, out) ? out[15] : 0u;
+    }
+    double parse_ns = (now_ns() - t0) / BENCH_ITERATIONS;
+
+    unsigned x[16];
+    t0 = now_ns();
+    for (int i = 0; i < (BENCH_ITERATIONS / 10); i++) {
+        sink += (unsigned)sscanf(sample, "%2x%2x%2x%2x-%2x%2x-%2x%2x-%2x%2x-%2x%2x%2x%2x%2x%2x", &x[0], &x[1], &x[2],
+                                 &x[3], &x[4], &x[5], &x[6], &x[7], &x[8], &x[9], &x[10], &x[11], &x[12], &x[13], &x[14],
+                                 &x[15]);
+    }
+    double sscanf_ns = (now_ns() - t0) / (BENCH_ITERATIONS / 10);
+
+    printf("parse_uuid %.1f ns/op, sscanf %.1f ns/op\n", parse_ns, sscanf_ns);
+    return (failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,140 @@
+// Generates the service-name perfect hash tables (service_disp and service_table)
+// used by parse_port() in resources/cli_args.c.
+//
+// Usage, from the repository root:
+//   node test/tools/gen_service_table.js           check that cli_args.c matches (exit 1 if not)
+//   node test/tools/gen_service_table.js --write   rewrite the tables in cli_args.c
+//   node test/tools/gen_service_table.js --print   print the generated tables
+//
+// To add a service, append it to SERVICES and run with --write. The layout constants
+// must match SERVICE_NAME_MAX, SERVICE_BUCKETS and SERVICE_SLOTS in cli_args.c.
+const path = require('path');
+const fs = require('fs');
+
+const SOURCE = path.join(__dirname, '..', '..', 'resources', 'cli_args.c');
+const NAME_MAX = 16;
+const BUCKETS = 64;
+const SLOTS = 128;
+
+// Well-known service names from the IANA port registry (lower case).
+const SERVICES = [
+  ['echo', 7], ['discard', 9], ['daytime', 13], ['ftp-data', 20], ['ftp', 21], ['ssh', 22], ['telnet', 23],
+  ['smtp', 25], ['time', 37], ['nicname', 43], ['whois', 43], ['tacacs', 49], ['domain', 53], ['dns', 53],
+  ['bootps', 67], ['bootpc', 68], ['tftp', 69], ['gopher', 70], ['finger', 79], ['http', 80], ['www', 80],
+  ['kerberos', 88], ['pop3', 110], ['sunrpc', 111], ['auth', 113], ['nntp', 119], ['ntp', 123], ['epmap', 135],
+  ['netbios-ns', 137], ['netbios-dgm', 138], ['netbios-ssn', 139], ['imap', 143], ['snmp', 161],
+  ['snmptrap', 162], ['xdmcp', 177], ['bgp', 179], ['irc', 194], ['ldap', 389], ['https', 443],
+  ['microsoft-ds', 445], ['kpasswd', 464], ['submissions', 465], ['smtps', 465], ['isakmp', 500],
+  ['syslog', 514], ['printer', 515], ['router', 520], ['rip', 520], ['ripng', 521], ['dhcpv6-client', 546],
+  ['dhcpv6-server', 547], ['rtsp', 554], ['submission', 587], ['ipp', 631], ['ldaps', 636], ['msdp', 639],
+  ['ldp', 646], ['kerberos-adm', 749], ['netconf-ssh', 830], ['rsync', 873], ['ftps-data', 989], ['ftps', 990],
+  ['telnets', 992], ['imaps', 993], ['pop3s', 995], ['socks', 1080], ['openvpn', 1194], ['ms-sql-s', 1433],
+  ['l2tp', 1701], ['pptp', 1723], ['radius', 1812], ['radius-acct', 1813], ['mqtt', 1883], ['nfs', 2049],
+  ['radsec', 2083], ['docker', 2375], ['docker-s', 2376], ['etcd-client', 2379], ['etcd-server', 2380],
+  ['mysql', 3306], ['ms-wbt-server', 3389], ['stun', 3478], ['svn', 3690], ['bfd-control', 3784],
+  ['bfd-echo', 3785], ['diameter', 3868], ['ipsec-nat-t', 4500], ['ipfix', 4739], ['ipfixs', 4740],
+  ['vxlan', 4789], ['sip', 5060], ['sips', 5061], ['xmpp-client', 5222], ['xmpp-server', 5269], ['mdns', 5353],
+  ['llmnr', 5355], ['postgresql', 5432], ['amqp', 5672], ['rfb', 5900], ['x11', 6000], ['geneve', 6081],
+  ['sflow', 6343], ['redis', 6379], ['netconf-tls', 6513], ['syslog-tls', 6514], ['openflow', 6653],
+  ['http-alt', 8080], ['memcache', 11211], ['mongodb', 27017],
+];
+
+// Same as fnv1a32() in cli_args.c: 32-bit FNV-1a with the seed folded into the offset basis.
+function fnv1a32(name, seed) {
+  let h = (2166136261 ^ seed) >>> 0;
+  for (const byte of Buffer.from(name, 'latin1')) {
+    h = Math.imul(h ^ byte, 16777619) >>> 0;
+  }
+  return h;
+}
+
+// CHD-style placement: fill the largest buckets first, giving each the smallest seed
+// (starting at 1) that puts all of its names into distinct free slots.
+function build(services) {
+  const seen = new Set();
+  for (const [name, port] of services) {
+    if (seen.has(name) || name.length >= NAME_MAX || name !== name.toLowerCase() || port < 0 || port > 65535) {
+      throw new Error(`invalid or duplicate service entry "${name}"`);
+    }
+    seen.add(name);
+  }
+
+  const buckets = Array.from({ length: BUCKETS }, () => []);
+  for (const entry of services) {
+    buckets[fnv1a32(entry[0], 0) & (BUCKETS - 1)].push(entry);
+  }
+  const order = [...buckets.keys()].sort((a, b) => buckets[b].length - buckets[a].length);
+  const slots = new Array(SLOTS).fill(null);
+  const disp = new Array(BUCKETS).fill(0);
+
+  for (const b of order) {
+    if (buckets[b].length === 0) {
+      continue;
+    }
+    let placed = false;
+    for (let seed = 1; (seed < 256) && !placed; seed++) {
+      const pos = buckets[b].map(([name]) => fnv1a32(name, seed) & (SLOTS - 1));
+      if ((new Set(pos).size === pos.length) && pos.every((p) => slots[p] === null)) {
+        pos.forEach((p, i) => { slots[p] = buckets[b][i]; });
+        disp[b] = seed;
+        placed = true;
+      }
+    }
+    if (!placed) {
+      throw new Error(`no 8-bit seed places bucket ${b}; raise SERVICE_SLOTS`);
+    }
+  }
+  return { disp, slots };
+}
+
+function renderDisp(disp) {
+  const lines = [];
+  for (let i = 0; i < disp.length; i += 8) {
+    lines.push(`    ${disp.slice(i, i + 8).join(', ')},`);
+  }
+  return `static const unsigned char service_disp[SERVICE_BUCKETS] = {\n${lines.join('\n')}\n};`;
+}
+
+function renderSlots(slots) {
+  const lines = slots.map((s) => (s ? `    { "${s[0]}", ${s[1]} },` : '    { "", 0 },'));
+  return `static const service_entry_t service_table[SERVICE_SLOTS] = {\n${lines.join('\n')}\n};`;
+}
+
+const DISP_RE = /static const unsigned char service_disp\[SERVICE_BUCKETS\] = \{\n[^}]*\};/;
+const SLOTS_RE = /static const service_entry_t service_table\[SERVICE_SLOTS\] = \{\n(?:    \{ "[^"]*", \d+ \},\n)*\};/;
+
+function main() {
+  const mode = process.argv[2] || '--check';
+  const { disp, slots } = build(SERVICES);
+  const dispText = renderDisp(disp);
+  const slotsText = renderSlots(slots);
+
+  if (mode === '--print') {
+    console.log(`${dispText}\n\n${slotsText}`);
+    return 0;
+  }
+  const source = fs.readFileSync(SOURCE, 'utf8');
+  const dispMatch = source.match(DISP_RE);
+  const slotsMatch = source.match(SLOTS_RE);
+  if (!dispMatch || !slotsMatch) {
+    console.error(`${SOURCE}: service_disp or service_table not found`);
+    return 1;
+  }
+  if (mode === '--write') {
+    fs.writeFileSync(SOURCE, source.replace(DISP_RE, () => dispText).replace(SLOTS_RE, () => slotsText));
+    console.log(`wrote ${SERVICES.length} services into ${SLOTS} slots`);
+    return 0;
+  }
+  if (mode !== '--check') {
+    console.error(`unknown option ${mode}`);
+    return 2;
+  }
+  if ((dispMatch[0] !== dispText) || (slotsMatch[0] !== slotsText)) {
+    console.error('service tables in cli_args.c differ from the generator output; run with --write');
+    return 1;
+  }
+  console.log(`service tables match (${SERVICES.length} services, ${SLOTS} slots)`);
+  return 0;
+}
+
+process.exitCode = main();